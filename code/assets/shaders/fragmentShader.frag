@@ -4,6 +4,9 @@ uniform bool useTexture;
 uniform sampler2D texture1;
 uniform vec2 uvOffset;
 uniform vec4 color;
+// Rect of the image on its texture (atlas page), TexCoord is local to the image
+uniform vec4 atlasRect;
+uniform bool repeatTexture;
 
 out vec4 FragColor;
 
@@ -13,15 +16,19 @@ void main() {
     if (useTexture) {
         // Apply UV parallax offset
         vec2 offsetUV = TexCoord + uvOffset;
-        vec4 texColor = texture(texture1, offsetUV);
-
-
-
-        finalColor = texColor;
+        // Emulate clamp to (transparent) border and repeat inside the atlas rect
+        if (!repeatTexture && (any(lessThan(offsetUV, vec2(0.0))) || any(greaterThan(offsetUV, vec2(1.0))))) {
+            finalColor = vec4(0.0);
+        } else {
+            vec2 wrappedUV = repeatTexture ? fract(offsetUV) : offsetUV;
+            vec2 rectSize = atlasRect.zw - atlasRect.xy;
+            finalColor = textureGrad(texture1, atlasRect.xy + wrappedUV * rectSize,
+                                     dFdx(offsetUV) * rectSize, dFdy(offsetUV) * rectSize);
+        }
     } else {
         // Use plain vertex color if no texture
         finalColor = color;
     }
 
     FragColor = finalColor;
-}
\ No newline at end of file
+}
@@ -2,12 +2,16 @@
 
 layout (location = 0) in vec3 aPos;
 
-uniform mat4 mvp;
+layout (std140, binding = 0) uniform FrameCamera {
+    mat4 viewProjection;
+    vec4 worldBounds; // left, right, top, bottom in meters
+    vec4 viewport; // xy: window size, z: pixels per meter
+};
+uniform mat4 model;
 
 out float vY;
 
 void main() {
-    gl_Position = mvp * vec4(aPos, 1.0);
+    gl_Position = viewProjection * model * vec4(aPos, 1.0);
     vY = aPos.y * 0.5 + 0.5;
 }
-
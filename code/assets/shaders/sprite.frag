@@ -0,0 +1,30 @@
+#version 460 core
+in vec2 TexCoord;
+in vec4 Color;
+flat in vec2 UvOffset;
+flat in int UseTexture;
+flat in int RepeatTexture;
+flat in vec4 AtlasRect;
+uniform sampler2D texture1;
+
+out vec4 FragColor;
+
+void main() {
+    if (UseTexture != 0) {
+        // Apply UV parallax offset, uvs are local to the image
+        vec2 localUV = TexCoord + UvOffset;
+        // Emulate clamp to (transparent) border and repeat inside the images rect on the atlas page
+        if (RepeatTexture == 0 && (any(lessThan(localUV, vec2(0.0))) || any(greaterThan(localUV, vec2(1.0))))) {
+            FragColor = vec4(0.0);
+            return;
+        }
+        vec2 wrappedUV = RepeatTexture != 0 ? fract(localUV) : localUV;
+        vec2 rectSize = AtlasRect.zw - AtlasRect.xy;
+        // Derivatives of the unwrapped uvs, so fract() doesn't select the smallest mip level at the seams
+        FragColor = textureGrad(texture1, AtlasRect.xy + wrappedUV * rectSize,
+                                dFdx(localUV) * rectSize, dFdy(localUV) * rectSize);
+    } else {
+        // Use plain color if no texture
+        FragColor = Color;
+    }
+}
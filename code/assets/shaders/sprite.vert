@@ -0,0 +1,33 @@
+#version 460 core
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec2 aTexCoord;
+// Per-instance attributes
+layout (location = 2) in mat4 aModel;
+layout (location = 6) in vec4 aUvRect;
+layout (location = 7) in vec4 aColor;
+layout (location = 8) in vec4 aUvParams;
+layout (location = 9) in vec4 aAtlasRect;
+
+layout (std140, binding = 0) uniform FrameCamera {
+    mat4 viewProjection;
+    vec4 worldBounds; // left, right, top, bottom in meters
+    vec4 viewport; // xy: window size, z: pixels per meter
+};
+
+out vec2 TexCoord;
+out vec4 Color;
+flat out vec2 UvOffset;
+flat out int UseTexture;
+flat out int RepeatTexture;
+flat out vec4 AtlasRect;
+
+void main() {
+    gl_Position = viewProjection * aModel * vec4(aPos, 1.0);
+    // Map the unit mesh uvs onto the sprites uv rect
+    TexCoord = mix(aUvRect.xy, aUvRect.zw, aTexCoord);
+    Color = aColor;
+    UvOffset = aUvParams.xy;
+    UseTexture = int(aUvParams.z);
+    RepeatTexture = int(aUvParams.w);
+    AtlasRect = aAtlasRect;
+}
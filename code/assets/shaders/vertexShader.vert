@@ -2,10 +2,17 @@
 layout (location = 0) in vec3 aPos;
 layout (location = 1) in vec2 aTexCoord;
 
-uniform mat4 mvp;
+layout (std140, binding = 0) uniform FrameCamera {
+    mat4 viewProjection;
+    vec4 worldBounds; // left, right, top, bottom in meters
+    vec4 viewport; // xy: window size, z: pixels per meter
+};
+uniform mat4 model;
+// Maps the shared unit mesh uvs onto the entity's uv rect (u_min, v_min, u_max, v_max)
+uniform vec4 uvRect;
 out vec2 TexCoord;
 
 void main() {
-    gl_Position = mvp * vec4(aPos, 1.0);
-    TexCoord = aTexCoord;
-}
\ No newline at end of file
+    gl_Position = viewProjection * model * vec4(aPos, 1.0);
+    TexCoord = mix(uvRect.xy, uvRect.zw, aTexCoord);
+}
@@ -0,0 +1,138 @@
+/**
+* @file main.cpp
+ * @brief AudioAnalysisBenchmark: compares the fused single pass analysis with separate tempo and onset passes.
+ *
+ * Usage: AudioAnalysisBenchmark <track> [iterations] [bands] [workers]
+ * Analyzes the given track (ideally a multi-minute WAV) with the default AnalysisSettings:
+ * - separate: AudioAnalysis::analyzeAudioTempo followed by AudioAnalysis::analyzeAudioOnsets, two decodes
+ * - fused: AudioAnalysis::analyze, one decode feeding tempo and onset detection
+ * - fused + bands: AudioAnalysis::analyze, additionally tracking the given number of energy bands (default 8)
+ * - parallel + bands: AudioAnalysis::analyzeParallel on the given number of workers (default all hardware threads)
+ * Also checks that the fused pass finds the same tempo and onsets as the separate passes, and that the parallel
+ * analysis stays within the tolerance documented at AudioAnalysis::analyzeParallel.
+ */
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include "engine/JobSystem.h"
+#include "engine/audio/AudioAnalysis.h"
+
+using namespace gl3::engine;
+
+namespace
+{
+    /**
+     * @brief Average time of repeated analyses.
+     * @param analyze Analyzes the track once.
+     * @param iterations Number of measured analyses.
+     * @return Average milliseconds per analysis.
+     */
+    double measure(const std::function<void()>& analyze, const int iterations)
+    {
+        analyze(); // Warm up the file cache
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; ++i)
+        {
+            analyze();
+        }
+        const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        return elapsed.count() / iterations;
+    }
+
+    /**
+     * @brief Print one row of the results.
+     * @param name Name of the variant.
+     * @param milliseconds Average time per analysis.
+     * @param baseline Average time of the separate passes.
+     */
+    void printRow(const std::string& name, const double milliseconds, const double baseline)
+    {
+        std::cout << std::setw(16) << name << std::setw(12) << milliseconds << std::setw(9) << baseline / milliseconds
+            << "x" << std::endl;
+    }
+}
+
+int main(const int argc, char* argv[])
+{
+    if (argc < 2)
+    {
+        std::cerr << "Usage: AudioAnalysisBenchmark <track> [iterations] [bands] [workers]" << std::endl;
+        return 1;
+    }
+    const std::string trackPath = argv[1];
+    const int iterations = argc > 2 ? std::max(1, std::stoi(argv[2])) : 3;
+    const unsigned bands = argc > 3 ? static_cast<unsigned>(std::max(1, std::stoi(argv[3]))) : 8u;
+    JobSystem jobSystem(argc > 4 ? static_cast<uint32_t>(std::max(1, std::stoi(argv[4]))) : 0u);
+
+    const AnalysisSettings settings;
+    AnalysisSettings bandSettings;
+    bandSettings.energyBands = bands;
+
+    float separateBpm = 0.f;
+    std::vector<float> separateOnsets;
+    AnalysisResult fused;
+    AnalysisResult fusedBands;
+    AnalysisResult parallelBands;
+
+    const double separate = measure([&]
+    {
+        separateBpm = AudioAnalysis::analyzeAudioTempo(trackPath, settings.hopSize, settings.bufferSize);
+        separateOnsets = AudioAnalysis::analyzeAudioOnsets(trackPath, settings.hopSize, settings.bufferSize,
+                                                           settings.onsetMethod, settings.onsetThreshold,
+                                                           settings.minInterOnsetInterval);
+    }, iterations);
+    const double fusedTime = measure([&] { fused = AudioAnalysis::analyze(trackPath, settings); }, iterations);
+    const double fusedBandsTime = measure([&] { fusedBands = AudioAnalysis::analyze(trackPath, bandSettings); },
+                                          iterations);
+    const double parallelTime = measure([&]
+    {
+        parallelBands = AudioAnalysis::analyzeParallel(trackPath, bandSettings, jobSystem);
+    }, iterations);
+
+    if (fused.bpm <= 0.f)
+    {
+        std::cerr << "AudioAnalysisBenchmark: Failed to analyze " << trackPath << std::endl;
+        return 1;
+    }
+
+    std::cout << "Average analysis time in ms over " << iterations << " runs, " << fused.onsets.size() << " onsets, "
+        << fused.beats.size() << " beats, " << fusedBands.getFrameCount() << " hops\n";
+    std::cout << std::setw(16) << "variant" << std::setw(12) << "ms" << std::setw(10) << "speedup" << '\n'
+        << std::fixed << std::setprecision(3);
+    printRow("separate", separate, separate);
+    printRow("fused", fusedTime, separate);
+    printRow("fused + " + std::to_string(bands) + " bands", fusedBandsTime, separate);
+    printRow("parallel x" + std::to_string(jobSystem.getWorkerCount()), parallelTime, separate);
+
+    // Same frames through the same detectors, so the results have to be identical
+    if (fused.bpm != separateBpm || fused.onsets != separateOnsets)
+    {
+        std::cerr << "AudioAnalysisBenchmark: Fused result differs from the separate passes (bpm " << fused.bpm
+            << " vs " << separateBpm << ", " << fused.onsets.size() << " vs " << separateOnsets.size() << " onsets)"
+            << std::endl;
+        return 1;
+    }
+
+    // Onsets of the parallel analysis that the serial one found too, the others lie right after seams
+    size_t matched = 0;
+    const float hopSeconds = fusedBands.frameDuration;
+    for (const float onset : parallelBands.onsets)
+    {
+        const auto nearest = std::ranges::lower_bound(fusedBands.onsets, onset - hopSeconds);
+        if (nearest != fusedBands.onsets.end() && *nearest <= onset + hopSeconds) ++matched;
+    }
+    std::cout << "parallel: " << parallelBands.onsets.size() << " onsets, " << matched << " within a hop of "
+        << fusedBands.onsets.size() << " serial onsets" << std::endl;
+    if (parallelBands.bpm != fusedBands.bpm || parallelBands.beats != fusedBands.beats ||
+        parallelBands.bandEnergy != fusedBands.bandEnergy)
+    {
+        std::cerr << "AudioAnalysisBenchmark: Parallel tempo or band energies differ from the serial analysis (bpm "
+            << parallelBands.bpm << " vs " << fusedBands.bpm << ", " << parallelBands.beats.size() << " vs "
+            << fusedBands.beats.size() << " beats)" << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,135 @@
+/**
+* @file main.cpp
+ * @brief LevelLoadBenchmark: compares loading levels from JSON and from memory mapped binary .lvlb files.
+ *
+ * Usage: LevelLoadBenchmark <level.json> [iterations]
+ * Loads the given level (e.g. assets/levels/Forces.json) and a synthetic level with its objects and groups repeated
+ * 100 times along x, once through LevelFile::readJson and once through LevelFile::readBinary.
+ */
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include "engine/levelLoading/LevelFile.h"
+
+using namespace gl3::engine::levelLoading;
+
+namespace
+{
+    constexpr int syntheticRepeats = 100;
+
+    /**
+     * @brief Average time of repeated loads.
+     * @param load Loads the level once.
+     * @param iterations Number of measured loads.
+     * @return Average milliseconds per load.
+     */
+    double measure(const std::function<Level()>& load, const int iterations)
+    {
+        size_t objects = load().objects.size(); // Warm up the file cache
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; ++i)
+        {
+            objects += load().objects.size();
+        }
+        const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        if (objects == 0) std::cout << "(level has no objects)\n";
+        return elapsed.count() / iterations;
+    }
+
+    /**
+     * @brief Repeat a level's objects and groups along x, the level shifted by its own length each time.
+     * @param level The level to repeat.
+     * @return The longer level.
+     */
+    Level makeSynthetic(const Level& level)
+    {
+        float length = 1.f;
+        for (const auto& object : level.objects)
+        {
+            length = std::max(length, object.position.x + object.scale.x);
+        }
+
+        Level synthetic = level;
+        for (int repeat = 1; repeat < syntheticRepeats; ++repeat)
+        {
+            const float offset = length * static_cast<float>(repeat);
+            for (auto object : level.objects)
+            {
+                object.position.x += offset;
+                synthetic.objects.push_back(std::move(object));
+            }
+            for (auto group : level.groups)
+            {
+                group.ID = ++synthetic.currentGroupIDs;
+                group.parent.position.x += offset;
+                for (auto& child : group.children)
+                {
+                    child.position.x += offset;
+                }
+                synthetic.groups.push_back(std::move(group));
+            }
+        }
+        return synthetic;
+    }
+
+    /**
+     * @brief Write a level as JSON and binary, then time loading both.
+     * @param name Name printed in the results.
+     * @param level The level.
+     * @param jsonPath Where to write the JSON, the binary goes next to it.
+     * @param iterations Number of measured loads per format.
+     */
+    void compare(const std::string& name, const Level& level, const std::filesystem::path& jsonPath,
+                 const int iterations)
+    {
+        LevelFile::writeJsonAndBinary(level, jsonPath);
+        const auto binaryPath = LevelFile::binaryPathFor(jsonPath);
+
+        const double json = measure([&] { return LevelFile::readJson(jsonPath); }, iterations);
+        const double binary = measure([&] { return LevelFile::readBinary(binaryPath); }, iterations);
+
+        std::cout << std::setw(12) << name << std::setw(10) << level.objects.size()
+            << std::setw(12) << std::filesystem::file_size(jsonPath) / 1024 << std::setw(12)
+            << std::filesystem::file_size(binaryPath) / 1024 << std::setw(12) << json << std::setw(12) << binary
+            << std::setw(9) << json / binary << "x" << std::endl;
+    }
+}
+
+int main(const int argc, char* argv[])
+{
+    if (argc < 2)
+    {
+        std::cerr << "Usage: LevelLoadBenchmark <level.json> [iterations]" << std::endl;
+        return 1;
+    }
+    const std::filesystem::path levelPath = argv[1];
+    const int iterations = argc > 2 ? std::max(1, std::stoi(argv[2])) : 50;
+
+    try
+    {
+        const Level level = LevelFile::readJson(levelPath);
+        const auto tempDir = std::filesystem::temp_directory_path() / "LevelLoadBenchmark";
+        std::filesystem::create_directories(tempDir);
+
+        std::cout << "Average load time in ms over " << iterations << " loads\n";
+        std::cout << std::setw(12) << "level" << std::setw(10) << "objects" << std::setw(12) << "json KiB"
+            << std::setw(12) << "lvlb KiB" << std::setw(12) << "json" << std::setw(12) << "lvlb" << std::setw(10)
+            << "speedup" << '\n' << std::fixed << std::setprecision(3);
+
+        compare(levelPath.stem().string(), level, tempDir / levelPath.filename(), iterations);
+        compare("x" + std::to_string(syntheticRepeats), makeSynthetic(level), tempDir / "Synthetic.json",
+                std::max(1, iterations / 10));
+
+        std::filesystem::remove_all(tempDir);
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "LevelLoadBenchmark: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,154 @@
+/**
+* @file main.cpp
+ * @brief PhysicsStepBenchmark: measures b2World_Step time against body count and physics worker count.
+ *
+ * Usage: PhysicsStepBenchmark [steps]
+ * Generates levels of dense tile columns like the editor test levels, moving as kinematic bodies like in
+ * LevelPlayState::moveObjects, with a dynamic crate resting on every fourth tile column. Each level is stepped with
+ * the same fixed time step as the PhysicsSystem, once per worker count.
+ */
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "engine/JobSystem.h"
+#include "engine/ecs/EntityFactory.h"
+
+using namespace gl3::engine;
+
+namespace
+{
+    constexpr float fixedTimeStep = 1.0f / 60.0f; ///< Same as the PhysicsSystem
+    constexpr int subStepCount = 4; ///< Same as the PhysicsSystem
+    constexpr int warmUpSteps = 30;
+    constexpr int tilesPerColumn = 6;
+    constexpr float levelSpeed = 5.f;
+
+    /**
+     * @brief Time of the measured steps.
+     */
+    struct StepTimes
+    {
+        double average = 0.0; ///< Milliseconds
+        double max = 0.0; ///< Milliseconds
+    };
+
+    /**
+     * @brief Fill a world with a generated level.
+     * @param world The world.
+     * @param bodyCount Number of bodies to create.
+     */
+    void generateLevel(const b2WorldId world, const int bodyCount)
+    {
+        int created = 0;
+        for (int column = 0; created < bodyCount; ++column)
+        {
+            // Tiles through the level's factory, they get the same body and shape setup as in the game
+            for (int row = 0; row < tilesPerColumn && created < bodyCount; ++row, ++created)
+            {
+                GameObject tile;
+                tile.tag = "platform";
+                tile.position = {static_cast<float>(column), static_cast<float>(row) - 3.f, 0.f};
+                tile.isTriangle = row == tilesPerColumn - 1 && column % 3 == 0;
+
+                const auto entity = static_cast<entt::entity>(created);
+                const b2BodyDef bodyDef = ecs::EntityFactory::createBodyDef(entity, tile);
+                const b2BodyId body = b2CreateBody(world, &bodyDef);
+                ecs::EntityFactory::createShape(body, tile);
+                b2Body_SetType(body, b2_kinematicBody);
+                b2Body_SetLinearVelocity(body, {-levelSpeed, 0.f});
+            }
+
+            if (column % 4 != 0 || created >= bodyCount) continue;
+
+            b2BodyDef crateDef = b2DefaultBodyDef();
+            crateDef.type = b2_dynamicBody;
+            crateDef.position = {static_cast<float>(column), static_cast<float>(tilesPerColumn) - 2.5f};
+            const b2BodyId crate = b2CreateBody(world, &crateDef);
+            b2ShapeDef crateShape = b2DefaultShapeDef();
+            crateShape.density = 1.f;
+            const b2Polygon box = b2MakeBox(0.4f, 0.4f);
+            b2CreatePolygonShape(crate, &crateShape, &box);
+            ++created;
+        }
+    }
+
+    /**
+     * @brief Step a generated level and measure the step time.
+     * @param bodyCount Number of bodies in the level.
+     * @param jobs The job system to step on.
+     * @param steps Number of measured steps.
+     * @return The measured step times.
+     */
+    StepTimes measure(const int bodyCount, JobSystem& jobs, const int steps)
+    {
+        b2WorldDef worldDef = b2DefaultWorldDef();
+        worldDef.gravity = {0.f, -10.f};
+        jobs.configureWorld(worldDef);
+        const b2WorldId world = b2CreateWorld(&worldDef);
+        generateLevel(world, bodyCount);
+
+        for (int i = 0; i < warmUpSteps; ++i)
+        {
+            b2World_Step(world, fixedTimeStep, subStepCount);
+        }
+
+        StepTimes times;
+        for (int i = 0; i < steps; ++i)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            b2World_Step(world, fixedTimeStep, subStepCount);
+            const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+            times.average += elapsed.count();
+            times.max = std::max(times.max, elapsed.count());
+        }
+        times.average /= steps;
+
+        b2DestroyWorld(world);
+        return times;
+    }
+}
+
+int main(const int argc, char* argv[])
+{
+    const int steps = argc > 1 ? std::max(1, std::stoi(argv[1])) : 300;
+    const std::vector bodyCounts = {1000, 2000, 4000, 8000, 16000};
+
+    std::vector<uint32_t> workerCounts = {1, 2, 4};
+    const uint32_t hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+    std::erase_if(workerCounts, [&](const uint32_t count) { return count > hardwareThreads; });
+    if (workerCounts.back() != hardwareThreads) workerCounts.push_back(hardwareThreads);
+
+    std::cout << "Average (max) b2World_Step time in ms over " << steps << " steps\n";
+    std::cout << std::setw(8) << "bodies";
+    for (const auto workers : workerCounts)
+    {
+        std::cout << std::setw(20) << std::to_string(workers) + " worker(s)";
+    }
+    std::cout << '\n' << std::fixed << std::setprecision(3);
+
+    std::vector<std::unique_ptr<JobSystem>> jobSystems;
+    for (const auto workers : workerCounts)
+    {
+        jobSystems.push_back(std::make_unique<JobSystem>(workers));
+    }
+
+    for (const int bodyCount : bodyCounts)
+    {
+        std::cout << std::setw(8) << bodyCount;
+        for (const auto& jobs : jobSystems)
+        {
+            const auto [average, max] = measure(bodyCount, *jobs, steps);
+            std::ostringstream cell;
+            cell << std::fixed << std::setprecision(3) << average << " (" << max << ")";
+            std::cout << std::setw(20) << cell.str();
+        }
+        std::cout << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,169 @@
+/**
+* @file main.cpp
+ * @brief ViewIterationBenchmark: measures enTT view iteration throughput of the transform and render components.
+ *
+ * Usage: ViewIterationBenchmark [passes]
+ * Fills registries with level-sized entity counts, once with the components as they were before the hot/cold split
+ * (initial transform and shader data inline) and once with the engine's components. Each pass runs the per-frame
+ * work of the PhysicsSystem (writing positions) and the RenderingSystem (reading transforms and render data,
+ * scrolling parallax uvs).
+ */
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "engine/ecs/EntityFactory.h"
+
+using namespace gl3::engine;
+
+namespace
+{
+    constexpr int warmUpPasses = 5;
+
+    /// TransformComponent before the split, reset values inline with the per-frame ones.
+    struct FatTransformComponent
+    {
+        glm::vec3 initialPosition;
+        glm::vec2 previousPosition;
+        glm::vec3 initialScale;
+        float initialZRotation;
+        glm::vec3 position;
+        glm::vec3 scale;
+        float zRotation;
+        float parallaxFactor;
+    };
+
+    /// RenderComponent before the split, every entity carries a shader handle and gradient colors.
+    struct FatRenderComponent
+    {
+        rendering::ShaderHandle shader;
+        glm::vec4 color = {1.0f, 0.0f, 0.0f, 1.0f};
+        glm::vec4 gradientTopColor = {1, 1, 1, 1};
+        glm::vec4 gradientBottomColor = {1, 1, 1, 1};
+        const rendering::Texture* texture = nullptr;
+        glm::vec4 atlasRect = {0.f, 0.f, 1.f, 1.f};
+        bool repeatX = false;
+        float repeatAmount = 0.f;
+        glm::vec4 uv = {0.f, 0.f, 1.f, 1.f};
+        rendering::SpriteShape shape = rendering::SpriteShape::Quad;
+        bool isBatched = true;
+        glm::vec2 uvOffset = {0.0f, 0.0f};
+        bool isActive = true;
+    };
+
+    /**
+     * @brief One frame of component work, the value keeps the compiler from dropping the reads.
+     * @tparam Transform The transform component type.
+     * @tparam Render The render component type.
+     * @param registry The registry holding the entities.
+     * @return Sum of the read values.
+     */
+    template <typename Transform, typename Render>
+    float runPass(entt::registry& registry)
+    {
+        // PhysicsSystem: positions of moved bodies
+        for (auto&& [entity, transform] : registry.view<Transform>().each())
+        {
+            transform.previousPosition = transform.position;
+            transform.position.x -= 0.1f;
+        }
+
+        // RenderingSystem: visibility, parallax and sprite submission
+        float checksum = 0.f;
+        for (auto&& [entity, transform, renderComp] : registry.view<Transform, Render>().each())
+        {
+            if (!renderComp.isActive || transform.position.x + transform.scale.x < -100.f) continue;
+            if (transform.parallaxFactor != 0.f)
+            {
+                renderComp.uvOffset.x += transform.parallaxFactor * 0.01f;
+            }
+            checksum += transform.position.y * transform.scale.y + transform.zRotation + renderComp.color.r +
+                renderComp.uv.x + renderComp.atlasRect.z + renderComp.uvOffset.x;
+        }
+        return checksum;
+    }
+
+    /**
+     * @brief Measure passes over a registry.
+     * @param registry The registry holding the entities.
+     * @param passes Number of measured passes.
+     * @return Average milliseconds per pass.
+     */
+    template <typename Transform, typename Render>
+    double measure(entt::registry& registry, const int passes)
+    {
+        volatile float sink = 0.f;
+        for (int i = 0; i < warmUpPasses; ++i)
+        {
+            sink = sink + runPass<Transform, Render>(registry);
+        }
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < passes; ++i)
+        {
+            sink = sink + runPass<Transform, Render>(registry);
+        }
+        const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        return elapsed.count() / passes;
+    }
+
+    /**
+     * @brief Position of the i-th generated entity, tiles in columns of six like the editor test levels.
+     */
+    glm::vec3 tilePosition(const int i)
+    {
+        return {static_cast<float>(i / 6), static_cast<float>(i % 6) - 3.f, 0.f};
+    }
+
+    double measureFat(const int entityCount, const int passes)
+    {
+        entt::registry registry;
+        for (int i = 0; i < entityCount; ++i)
+        {
+            const auto entity = registry.create();
+            const glm::vec3 position = tilePosition(i);
+            registry.emplace<FatTransformComponent>(entity, position, glm::vec2(position), glm::vec3(1.f), 0.f,
+                                                    position, glm::vec3(1.f), 0.f, i % 50 == 0 ? 0.5f : 0.f);
+            registry.emplace<FatRenderComponent>(entity);
+        }
+        return measure<FatTransformComponent, FatRenderComponent>(registry, passes);
+    }
+
+    double measureSplit(const int entityCount, const int passes)
+    {
+        entt::registry registry;
+        for (int i = 0; i < entityCount; ++i)
+        {
+            const auto entity = registry.create();
+            const glm::vec3 position = tilePosition(i);
+            registry.emplace<ecs::TransformComponent>(entity, position, glm::vec3(1.f), 0.f,
+                                                      i % 50 == 0 ? 0.5f : 0.f);
+            registry.emplace<ecs::InitialTransformComponent>(entity, position, glm::vec3(1.f), 0.f);
+            registry.emplace<ecs::RenderComponent>(entity);
+        }
+        return measure<ecs::TransformComponent, ecs::RenderComponent>(registry, passes);
+    }
+}
+
+int main(const int argc, char* argv[])
+{
+    const int passes = argc > 1 ? std::max(1, std::stoi(argv[1])) : 200;
+    const std::vector entityCounts = {1000, 10000, 100000, 500000};
+
+    std::cout << "Average ms per frame pass over " << passes << " passes\n";
+    std::cout << "Component sizes (bytes): transform " << sizeof(FatTransformComponent) << " -> "
+        << sizeof(ecs::TransformComponent) << ", render " << sizeof(FatRenderComponent) << " -> "
+        << sizeof(ecs::RenderComponent) << '\n';
+    std::cout << std::setw(10) << "entities" << std::setw(14) << "before" << std::setw(14) << "after"
+        << std::setw(12) << "speedup" << '\n' << std::fixed << std::setprecision(3);
+
+    for (const int entityCount : entityCounts)
+    {
+        const double fat = measureFat(entityCount, passes);
+        const double split = measureSplit(entityCount, passes);
+        std::cout << std::setw(10) << entityCount << std::setw(14) << fat << std::setw(14) << split
+            << std::setw(11) << fat / split << "x" << std::endl;
+    }
+    return 0;
+}
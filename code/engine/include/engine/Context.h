@@ -7,6 +7,7 @@
 #include "glm/vec2.hpp"
 #include "glm/vec3.hpp"
 #include "glm/vec4.hpp"
+#include "engine/rendering/FrameCamera.h"
 
 namespace gl3::engine::context
 {
@@ -57,6 +58,11 @@ namespace gl3::engine::context
    */
   ~Context();
 
+  /**
+   * @brief Free the frame camera uniform buffer. Call before the GL context is terminated.
+   */
+  void releaseGL();
+
   /**
    * @brief Runs the main loop, repeatedly calling the update callback.
    * @param update A function (the game's update) that is called every frame with the Context as an argument.
@@ -76,6 +82,12 @@ namespace gl3::engine::context
    */
   void moveCameraX(float dx);
 
+  /**
+   * @brief Scroll the visible world window along the X axis, then recompute world window bounds.
+   * @param distance The distance in meters the window should move.
+   */
+  void scrollWindowX(float distance);
+
   /// @return The GLFW window handle.
   [[nodiscard]] GLFWwindow* getWindow() const { return window; }
 
@@ -106,12 +118,19 @@ namespace gl3::engine::context
    */
   [[nodiscard]] std::vector<float>& getWorldWindowBounds() { return windowBounds; }
 
+  /**
+   * @brief Get the camera snapshot of the current frame.
+   * @return View/projection matrices, world window bounds and window size, updated once per frame and on camera change.
+   */
+  [[nodiscard]] const rendering::FrameCamera& getFrameCamera() const { return frameCamera; }
+
   /**
    * @brief Check if a point is within the visible window bounds.
    * @param position The point to test.
    * @param scale The object's scale.
    * @param margin Optional margin.
    * @return True if the point is inside the visible area.
+   * @note Only reads the cached bounds of the FrameCamera, so this is cheap enough to call per entity.
    */
   [[nodiscard]] bool isInVisibleWindow(const glm::vec3& position, glm::vec3 scale,
                                        float margin = 0.f) const;
@@ -122,6 +141,17 @@ namespace gl3::engine::context
    */
   void onExitApplication() const;
 
+  /**
+   * @brief Recompute the FrameCamera from the current camera and cached window size and upload it to the
+   * uniform buffer bound at @ref rendering::frameCameraBindingPoint.
+   */
+  void updateFrameCamera();
+
+  /**
+   * @brief Query and cache the current window size.
+   */
+  void refreshWindowSize();
+
   /**
    * @brief GLFW framebuffer resize callback.
    */
@@ -138,5 +168,9 @@ namespace gl3::engine::context
   glm::vec3 cameraCenter{0.0f, 0.0f, 0.0f}; ///< Camera look-at center.
   glm::vec4 clearColor = {1, 1, 1, 1}; ///< OpenGL clear color.
   std::vector<float> windowBounds; ///< World window bounds: {left, right, top, bottom}.
+  rendering::FrameCamera frameCamera; ///< Camera snapshot of the current frame.
+  GLuint frameCameraBuffer = 0; ///< Uniform buffer holding the FrameCameraBlock.
+  int windowWidth = 0; ///< Cached window width in screen coordinates.
+  int windowHeight = 0; ///< Cached window height in screen coordinates.
  };
 } // namespace gl3::engine::context
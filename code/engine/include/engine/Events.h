@@ -1,5 +1,6 @@
 #pragma once
 #include <functional>
+#include <list>
 
 /**
  * @file Events.h
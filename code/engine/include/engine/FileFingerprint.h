@@ -0,0 +1,119 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string_view>
+
+namespace gl3::engine
+{
+    /**
+     * @class FileFingerprint
+     * @brief FNV-1a hashing and the check whether a file still has the content something was derived from.
+     *
+     * Files derived from an asset (baked textures, binary levels, cached audio analyses) record the asset's size,
+     * hash and write time in their header, see @ref isCurrent.
+     */
+    class FileFingerprint
+    {
+    public:
+        /// Initial value of a 64 bit FNV-1a hash.
+        static constexpr uint64_t hashSeed = 14695981039346656037ull;
+
+        /**
+         * @brief 64 bit FNV-1a hash of a byte range.
+         * @param bytes The bytes to hash.
+         * @param seed Hash to continue from.
+         * @return The hash.
+         */
+        [[nodiscard]] static constexpr uint64_t hash(const std::span<const std::byte> bytes,
+                                                     uint64_t seed = hashSeed)
+        {
+            for (const std::byte byte : bytes)
+            {
+                seed ^= static_cast<uint64_t>(byte);
+                seed *= prime;
+            }
+            return seed;
+        }
+
+        /**
+         * @brief 64 bit FNV-1a hash of a string, at compile time or runtime.
+         * @param text The text to hash.
+         * @param seed Hash to continue from.
+         * @return The hash.
+         */
+        [[nodiscard]] static constexpr uint64_t hash(const std::string_view text, uint64_t seed = hashSeed)
+        {
+            for (const char c : text)
+            {
+                seed ^= static_cast<uint8_t>(c);
+                seed *= prime;
+            }
+            return seed;
+        }
+
+        /**
+         * @brief Map a file and hash its content.
+         * @param path Path to the file.
+         * @return The hash.
+         * @throws std::runtime_error If the file can't be mapped.
+         */
+        [[nodiscard]] static uint64_t hashFile(const std::filesystem::path& path);
+
+        /**
+         * @param path Path to a file.
+         * @return The file's last write time as a plain number, 0 if it can't be read.
+         */
+        [[nodiscard]] static int64_t getWriteTime(const std::filesystem::path& path);
+
+        /**
+         * @brief Check a source file against the size, hash and write time recorded when it was last hashed.
+         *
+         * - Size differs: changed.
+         * - Size and write time match: unchanged, the file is not read.
+         * - Only the write time differs (e.g. the file was copied): the file is hashed. If the content is unchanged,
+         *   writeTime receives the new write time, so the record can be refreshed and the next check doesn't hash.
+         * @param path Path to the source file.
+         * @param size Recorded size in bytes.
+         * @param sourceHash Recorded hash, @see hashFile
+         * @param writeTime Recorded write time, @see getWriteTime
+         * @return True if the file still has the recorded content.
+         */
+        [[nodiscard]] static bool matches(const std::filesystem::path& path, uint64_t size, uint64_t sourceHash,
+                                          int64_t& writeTime);
+
+        /**
+         * @brief Check a source file against the header of a file derived from it, see @ref matches.
+         *
+         * If only the write time changed, the new one is written to the derived file's header in place.
+         * @tparam Header File header starting the derived file, with sourceSize, sourceHash and sourceWriteTime.
+         * @param sourcePath Path to the source file.
+         * @param derivedPath Path to the derived file.
+         * @param header The derived file's header, its write time is updated if only that changed.
+         * @return True if the derived file was made from the source file's current content.
+         */
+        template <typename Header>
+        [[nodiscard]] static bool isCurrent(const std::filesystem::path& sourcePath,
+                                            const std::filesystem::path& derivedPath, Header& header)
+        {
+            const int64_t recordedWriteTime = header.sourceWriteTime;
+            if (!matches(sourcePath, header.sourceSize, header.sourceHash, header.sourceWriteTime)) return false;
+            if (header.sourceWriteTime != recordedWriteTime)
+            {
+                writeHeader(derivedPath, std::as_bytes(std::span(&header, 1)));
+            }
+            return true;
+        }
+
+    private:
+        static constexpr uint64_t prime = 1099511628211ull; ///< 64 bit FNV prime.
+
+        /**
+         * @brief Overwrite the start of a file, failures are only logged.
+         * @param path Path to the file.
+         * @param header The bytes to write.
+         */
+        static void writeHeader(const std::filesystem::path& path, std::span<const std::byte> header);
+    };
+}
@@ -18,6 +18,8 @@ namespace gl3::engine
   class PhysicsSystem;
  }
 
+ class JobSystem;
+
  namespace rendering
  {
   class RenderingSystem;
@@ -68,6 +70,11 @@ namespace gl3::engine
   /// @return The underlying GLFW window.
   [[nodiscard]] GLFWwindow* getWindow() const { return context.getWindow(); }
 
+  /// @return The worker threads stepping the physics world. Outside PhysicsSystem::step they can run other parallel
+  /// work, but only from the main thread: a JobSystem supports a single thread enqueuing and waiting. Work on other
+  /// threads, like the async level and audio loaders, needs a JobSystem of its own.
+  [[nodiscard]] JobSystem* getJobSystem() const { return job_system; }
+
   /// @return The Box2D physics world.
   [[nodiscard]] b2WorldId getPhysicsWorld() const { return physics_world; };
 
@@ -132,9 +139,11 @@ namespace gl3::engine
    * @param title Window title.
    * @param camPos Initial camera position.
    * @param camZoom Initial camera zoom level. @note zoom is not handled in Context window bounds calculation, preferably leave it as is or add engine functionality
+   * @param physicsWorkers Number of threads stepping the physics world (including the main thread), 0 uses all hardware threads.
    */
   explicit Game(int width = 0, int height = 0, const std::string& title = "Game",
-                glm::vec3 camPos = glm::vec3(0.0f, 0.0f, 1.0f), float camZoom = 1.f / 100.f);
+                glm::vec3 camPos = glm::vec3(0.0f, 0.0f, 1.0f), float camZoom = 1.f / 100.f,
+                unsigned physicsWorkers = 0);
 
   /**
    * @brief Destroy the Game.
@@ -191,6 +200,7 @@ namespace gl3::engine
 
   context::Context context; ///< Rendering context.
   float delta_time = 1.0f / 60; ///< Time step between frames.
+  JobSystem* job_system; ///< Runs the Box2D step on multiple threads.
   b2WorldId physics_world; ///< Box2D physics world.
 
   physics::PhysicsSystem* physics_system;
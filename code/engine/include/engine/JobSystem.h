@@ -0,0 +1,155 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include <box2d/types.h>
+
+namespace gl3::engine
+{
+    /**
+     * @class JobSystem
+     * @brief Fixed pool of worker threads running parallel-for style jobs, with a work-stealing queue per worker.
+     *
+     * A task is split into ranges that are spread over the worker queues. Workers pop from the back of their own
+     * queue and steal from the front of the others once it runs dry. The thread calling wait() takes part as worker 0,
+     * so a pool of n workers starts n - 1 threads. Also implements Box2D's task callbacks, see configureWorld().
+     * @note Only one thread at a time may enqueue and wait, usually the main thread.
+     */
+    class JobSystem
+    {
+    public:
+        /// Runs the items [startIndex, endIndex) of a task, same signature as Box2D's b2TaskCallback.
+        using TaskFunction = void(int32_t startIndex, int32_t endIndex, uint32_t workerIndex, void* context);
+
+        /**
+         * @brief Counts the unfinished ranges of the tasks enqueued with it.
+         */
+        struct TaskGroup
+        {
+            std::atomic<int32_t> pending = 0;
+        };
+
+        /**
+         * @brief Start the worker threads.
+         * @param workerCount Number of workers including the waiting thread, 0 uses all hardware threads.
+         * Clamped to maxWorkers.
+         */
+        explicit JobSystem(uint32_t workerCount = 0);
+
+        /**
+         * @brief Stop and join the worker threads. Queued jobs are dropped.
+         */
+        ~JobSystem();
+
+        JobSystem(const JobSystem&) = delete;
+        JobSystem& operator=(const JobSystem&) = delete;
+
+        /**
+         * @brief Split a task into ranges and queue them.
+         * @param group Group to wait on, must outlive the task.
+         * @param task Called once per range.
+         * @param itemCount Number of items to split.
+         * @param minRange Smallest range worth a job of its own.
+         * @param context Passed to the task, must outlive it.
+         */
+        void enqueue(TaskGroup& group, TaskFunction* task, int32_t itemCount, int32_t minRange, void* context);
+
+        /**
+         * @brief Run queued jobs on the calling thread (as worker 0) until all jobs of a group are done.
+         * @param group The group to wait on.
+         */
+        void wait(TaskGroup& group);
+
+        /**
+         * @brief Run a function over [0, itemCount) on all workers and wait for it.
+         * @param itemCount Number of items.
+         * @param minRange Smallest range worth a job of its own.
+         * @param func Called as func(startIndex, endIndex, workerIndex).
+         */
+        template <typename Func>
+        void parallelFor(const int32_t itemCount, const int32_t minRange, Func&& func)
+        {
+            using Callable = std::remove_reference_t<Func>;
+            TaskGroup group;
+            enqueue(group, [](const int32_t startIndex, const int32_t endIndex, const uint32_t workerIndex,
+                              void* context)
+                    {
+                        (*static_cast<Callable*>(context))(startIndex, endIndex, workerIndex);
+                    }, itemCount, minRange,
+                    const_cast<void*>(static_cast<const void*>(std::addressof(func))));
+            wait(group);
+        }
+
+        /**
+         * @brief Let a Box2D world run its step on this job system.
+         * @param worldDef Definition of the world to create, its task callbacks and worker count are set.
+         */
+        void configureWorld(b2WorldDef& worldDef);
+
+        /// Box2D's limit for the worker count of a world.
+        static constexpr uint32_t maxWorkers = 64;
+
+        /// @return Number of workers, including the waiting thread.
+        [[nodiscard]] uint32_t getWorkerCount() const { return static_cast<uint32_t>(queues.size()); }
+
+    private:
+        /**
+         * @brief A range of a task.
+         */
+        struct Job
+        {
+            TaskFunction* task;
+            void* context;
+            int32_t startIndex;
+            int32_t endIndex;
+            TaskGroup* group;
+        };
+
+        /**
+         * @brief The jobs queued for one worker, other workers steal from its front.
+         */
+        struct WorkerQueue
+        {
+            std::mutex mutex;
+            std::deque<Job> jobs;
+        };
+
+        /**
+         * @brief Run one job, taken from the worker's own queue or stolen from another one.
+         * @param workerIndex Index of the calling worker.
+         * @return False if all queues were empty.
+         */
+        bool runJob(uint32_t workerIndex);
+
+        /**
+         * @brief Loop of a worker thread, sleeps while there are no jobs.
+         */
+        void workerLoop(uint32_t workerIndex);
+
+        /// b2EnqueueTaskCallback, the user context is the JobSystem.
+        static void* enqueueBox2DTask(b2TaskCallback* task, int32_t itemCount, int32_t minRange, void* taskContext,
+                                      void* userContext);
+
+        /// b2FinishTaskCallback, the user task is the TaskGroup returned by enqueueBox2DTask.
+        static void finishBox2DTask(void* userTask, void* userContext);
+
+        std::vector<std::unique_ptr<WorkerQueue>> queues;
+        std::vector<std::thread> threads;
+        uint32_t next_queue = 0; ///< Queue receiving the next range, spreads tasks over the workers.
+
+        std::atomic<int32_t> queued_jobs = 0;
+        std::mutex sleep_mutex;
+        std::condition_variable wake;
+        bool stopping = false;
+
+        std::mutex box2d_mutex;
+        std::vector<std::unique_ptr<TaskGroup>> box2d_groups; ///< Owns the groups handed to Box2D.
+        std::vector<TaskGroup*> free_box2d_groups; ///< Groups of finished Box2D tasks, reused for the next ones.
+    };
+}
@@ -0,0 +1,68 @@
+#pragma once
+#include <cstddef>
+#include <filesystem>
+#include <span>
+
+namespace gl3::engine
+{
+    /**
+     * @class MappedFile
+     * @brief Read-only memory mapping of a whole file.
+     *
+     * The file content is paged in by the OS on first access instead of being copied into a buffer, so large
+     * pre-baked assets can be handed to OpenGL (or parsed in place) straight from the mapping.
+     */
+    class MappedFile
+    {
+    public:
+        /**
+         * @brief Map a file into memory.
+         * @param path Path to the file.
+         * @throws std::runtime_error If the file can't be opened or mapped.
+         */
+        explicit MappedFile(const std::filesystem::path& path);
+
+        /**
+         * @brief Unmap the file.
+         */
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        /**
+         * @brief Move constructor.
+         * @param other Mapping to move from.
+         */
+        MappedFile(MappedFile&& other) noexcept;
+
+        /**
+         * @brief Move assignment.
+         * @param other Mapping to move from.
+         * @return Reference to this mapping.
+         */
+        MappedFile& operator=(MappedFile&& other) noexcept;
+
+        /// @return Pointer to the first byte of the file, nullptr for empty files.
+        [[nodiscard]] const std::byte* data() const { return view; }
+
+        /// @return Size of the file in bytes.
+        [[nodiscard]] size_t size() const { return file_size; }
+
+        /// @return The whole file as bytes.
+        [[nodiscard]] std::span<const std::byte> bytes() const { return {view, file_size}; }
+
+    private:
+        /**
+         * @brief Unmap the view and close all handles.
+         */
+        void release();
+
+        const std::byte* view = nullptr;
+        size_t file_size = 0;
+#ifdef _WIN32
+        void* file_handle = nullptr; ///< HANDLE of the file.
+        void* mapping_handle = nullptr; ///< HANDLE of the file mapping.
+#endif
+    };
+}
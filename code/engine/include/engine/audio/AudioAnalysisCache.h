@@ -0,0 +1,96 @@
+#pragma once
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include "engine/audio/AudioAnalysis.h"
+
+namespace gl3::engine
+{
+    /**
+     * @brief File header of a cached audio analysis (.analysis sidecar).
+     *
+     * Layout: header, beatCount beat times, onsetCount onset times (floats, seconds), then bandFrameCount *
+     * energyBands band energies (floats, row major like AnalysisResult::bandEnergy).
+     */
+    struct AudioAnalysisCacheHeader
+    {
+        static constexpr uint32_t expectedMagic = 0x4E414C45; ///< "ELAN" in little endian.
+        /// Bump when the analysis itself changes, so results of the old analysis are dropped.
+        static constexpr uint32_t currentVersion = 2;
+
+        uint32_t magic = expectedMagic;
+        uint32_t version = currentVersion;
+        uint64_t settingsHash = 0; ///< Hash of the AnalysisSettings the result was computed with.
+        uint64_t sourceHash = 0; ///< FNV-1a hash of the audio file.
+        uint64_t sourceSize = 0; ///< Size of the audio file in bytes.
+        int64_t sourceWriteTime = 0; ///< Last write time of the audio file when it was last hashed.
+        float bpm = 0.f;
+        uint32_t beatCount = 0;
+        uint32_t onsetCount = 0;
+        uint32_t energyBands = 0; ///< Bands per row of band energies, 0 if none were tracked.
+        uint32_t bandFrameCount = 0; ///< Rows of band energies.
+        float frameDuration = 0.f; ///< Seconds between two rows of band energies.
+    };
+
+    /**
+     * @class AudioAnalysisCache
+     * @brief Keeps the analysis of each audio file in a binary sidecar (<track>.analysis next to the track).
+     *
+     * A cached result is valid for exactly the file content and AnalysisSettings it was computed with:
+     * - Different settings or another format version: the sidecar is ignored and overwritten.
+     * - Same size and write time as when the file was last hashed: hit without reading the audio file.
+     * - Size matches but the write time changed (e.g. the asset was copied): the audio file is hashed again. If the
+     *   content is unchanged it is a hit and the sidecar's write time is refreshed, otherwise the track is analyzed.
+     * Broken or truncated sidecars count as misses.
+     */
+    class AudioAnalysisCache
+    {
+    public:
+        /// File extension appended to the track's file name.
+        static constexpr auto extension = ".analysis";
+
+        /**
+         * @brief Load the cached analysis of a track, analyzing and caching it on a miss.
+         * @param audioPath Path to the audio file.
+         * @param settings Parameters of the analysis.
+         * @param jobSystem Analyzes a miss in parallel, nullptr analyzes on the calling thread.
+         * @return The analysis.
+         */
+        static AnalysisResult getOrAnalyze(const std::filesystem::path& audioPath, const AnalysisSettings& settings,
+                                           JobSystem* jobSystem = nullptr);
+
+        /**
+         * @brief Read a cached analysis if it is still valid for the track.
+         * @param audioPath Path to the audio file.
+         * @param cachePath Path to the sidecar.
+         * @param settings Parameters the analysis has to have been computed with.
+         * @return The cached analysis, std::nullopt on a miss.
+         */
+        static std::optional<AnalysisResult> load(const std::filesystem::path& audioPath,
+                                                  const std::filesystem::path& cachePath,
+                                                  const AnalysisSettings& settings);
+
+        /**
+         * @brief Write the analysis of a track to a sidecar.
+         * @param audioPath Path to the analyzed audio file.
+         * @param cachePath Destination path.
+         * @param settings Parameters the analysis was computed with.
+         * @param result The analysis.
+         * @throws std::runtime_error If the audio file can't be read or the sidecar can't be written.
+         */
+        static void store(const std::filesystem::path& audioPath, const std::filesystem::path& cachePath,
+                          const AnalysisSettings& settings, const AnalysisResult& result);
+
+        /**
+         * @param audioPath Path to an audio file.
+         * @return Path of its sidecar, e.g. assets/audio/Forces.mp3.analysis
+         */
+        static std::filesystem::path cachePathFor(const std::filesystem::path& audioPath);
+
+        /**
+         * @param settings Parameters of an analysis.
+         * @return Hash of every parameter that changes the result.
+         */
+        [[nodiscard]] static uint64_t hashSettings(const AnalysisSettings& settings);
+    };
+}
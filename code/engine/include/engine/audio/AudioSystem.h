@@ -5,7 +5,9 @@
 #pragma once
 #include <memory>
 #include <soloud.h>
+#include <soloud_file.h>
 #include <soloud_wav.h>
+#include <soloud_wavstream.h>
 
 #include "engine/Game.h"
 #include "engine/ecs/System.h"
@@ -20,15 +22,19 @@ namespace gl3::engine::audio
      * Stores the SoLoud audio engine instance, loaded background music,
      * analysis parameters for beat detection, playback state,
      * and user-defined audio settings like global volume.
+     * The background music is streamed from disk, so only the read-ahead buffer and the decoder state stay in memory
+     * instead of the whole decoded track.
      */
     struct AudioConfig
     {
         SoLoud::Soloud audio; /**< SoLoud audio engine instance. */
-        std::unique_ptr<SoLoud::Wav> backgroundMusic; /**< Loaded background music asset. */
+        std::unique_ptr<SoLoud::DiskFile> backgroundFile; /**< File the background music streams from. */
+        std::unique_ptr<SoLoud::WavStream> backgroundMusic; /**< Streaming background music, reads backgroundFile. */
         SoLoud::handle currentAudioHandle; /**< Handle for the currently playing audio. */
         std::string filePath; /**< Path to the loaded audio file. */
         unsigned int hopSize = 512; /**< Hop size for audio analysis. */
         unsigned int bufferSize = 2048; /**< Buffer size for audio analysis. */
+        unsigned int readAheadBytes = 256 * 1024; /**< Read-ahead buffer of the background music stream. */
         float bpm = 0.0f; /**< Estimated beats per minute (BPM). */
         float seconds_per_beat = 1.f; /**< Duration of a beat in seconds. */
         float current_audio_length = 0.f; /**< Total length of the current audio track in seconds. */
@@ -36,6 +42,20 @@ namespace gl3::engine::audio
         std::vector<float> beatPositions; /**< Detected beat timestamps (in seconds). */
     };
 
+    /**
+     * @struct LoadedAudio
+     * @brief An opened and analyzed background track, not yet handed to the AudioSystem.
+     * @see AudioSystem::loadAudio
+     */
+    struct LoadedAudio
+    {
+        std::unique_ptr<SoLoud::DiskFile> file; /**< File the track streams from, must outlive music. */
+        std::unique_ptr<SoLoud::WavStream> music; /**< The streaming track. */
+        std::string filePath; /**< Path to the audio file. */
+        float length = 0.f; /**< Length of the track in seconds. */
+        float bpm = 0.f; /**< Estimated beats per minute (BPM). */
+    };
+
     /**
  * @class AudioSystem
  * @brief ECS system for managing audio playback and sound effects.
@@ -88,6 +108,37 @@ namespace gl3::engine::audio
          */
         void initializeCurrentAudio(const std::string& fileName, float positionOffsetX = 0.f);
 
+        /**
+         * @brief Open and analyze a background track, without touching the AudioSystem.
+         *
+         * This is the expensive part of initializeCurrentAudio, it can run on a worker thread.
+         * The track isn't decoded up front, only its header is parsed and playback streams it through a read-ahead
+         * buffer. The analysis decodes the file with its own decoder and is cached next to the track,
+         * @see AudioAnalysisCache
+         * @param fileName Path to the audio file.
+         * @param hopSize Hop size for the tempo analysis.
+         * @param bufferSize Buffer size for the tempo analysis.
+         * @param readAheadBytes Size of the stream's read-ahead buffer.
+         * @param analysisJobs Analyzes an uncached track in parallel, @see getAnalysisJobSystem
+         * @return The streaming track and its tempo.
+         */
+        static LoadedAudio loadAudio(const std::string& fileName, unsigned hopSize, unsigned bufferSize,
+                                     unsigned readAheadBytes, JobSystem* analysisJobs);
+
+        /**
+         * @brief Make a track from loadAudio the current background audio track.
+         * @param loaded The decoded track.
+         * @param positionOffsetX Optional position x offset for beat positions (shift them to the right).
+         */
+        void setCurrentAudio(LoadedAudio loaded, float positionOffsetX = 0.f);
+
+        /**
+         * @brief The pool analyzing uncached tracks for loadAudio, separate from the game's physics pool.
+         * @note Only one thread at a time may load audio with it, like the level loader's single audio future.
+         * @return The analysis pool.
+         */
+        [[nodiscard]] JobSystem* getAnalysisJobSystem() const { return analysis_jobs.get(); }
+
         /**
          * @brief Get a pointer to the current AudioConfig.
          * @return Pointer to the AudioConfig.
@@ -124,6 +175,7 @@ namespace gl3::engine::audio
         std::unique_ptr<AudioConfig> config; /**< Current audio configuration and state. */
         std::unordered_map<std::string, std::unique_ptr<SoLoud::Wav>> one_shot_sounds; /**< Loaded one-shot SFX. */
         std::vector<SoLoud::handle> active_handles; /**< Handles of currently playing one-shots. */
+        std::unique_ptr<JobSystem> analysis_jobs; /**< Analyzes uncached tracks while a level loads. */
     };
 }
 
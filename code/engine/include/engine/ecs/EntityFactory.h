@@ -1,11 +1,17 @@
 #pragma once
+#include <optional>
 #include <entt/entt.hpp>
+#include "glm/common.hpp"
 #include "glm/vec3.hpp"
-#include "../rendering/Mesh.h"
-#include "../rendering/Shader.h"
+#include "../rendering/CustomShaderUniforms.h"
+#include "../rendering/MeshPool.h"
+#include "../rendering/ShaderCache.h"
+#include "../rendering/SpriteBatch.h"
 #include "box2d/id.h"
-#include "engine/rendering/Texture.h"
+#include "engine/rendering/TextureAtlas.h"
 #include "engine/levelLoading/Objects.h"
+#include "engine/ecs/Tags.h"
+#include "engine/physics/CollisionFilter.h"
 #include "engine/rendering/TextureManager.h"
 #include "glm/gtc/epsilon.hpp"
 
@@ -13,6 +19,7 @@ namespace gl3::engine::ecs
 {
     /**
      * @brief Component for z-sorting during rendering
+     * @note Change it with registry.patch/replace, the RenderQueue listens for those to re-bucket the entity.
      */
     struct ZLayerComponent
     {
@@ -36,12 +43,13 @@ namespace gl3::engine::ecs
         b2BodyId bodyID = b2_nullBodyId;
         int childCount = 0;
         int visibleChildren = 0;
+        std::vector<entt::entity> children; // Synced when the body reports a move
     };
 
     /**
-     * @brief Stores transform properties for an entity, used during rendering.
+     * @brief Stores the current transform of an entity, read every frame by rendering and physics.
      *
-     * Holds initial and current position, scale, rotation, and parallax factor.
+     * Holds position, scale, rotation, and parallax factor, the values to reset to are in InitialTransformComponent.
      * Supports (2D & 3D) position and scale with rotation around the Z axis.
      */
     struct TransformComponent
@@ -57,41 +65,84 @@ namespace gl3::engine::ecs
                                     const glm::vec3 scale = {1.0f, 1.0f, 1.0f},
                                     const float zRotation = 0.0f,
                                     const float parallax = 0.0f) :
-            initialPosition(position), previousPosition(position), initialScale(scale),
-            initialZRotation(zRotation), position(position), scale(scale), zRotation(zRotation),
+            position(position), scale(scale), previousPosition(position), zRotation(zRotation),
             parallaxFactor(parallax)
         {
         }
 
-        glm::vec3 initialPosition;
-        glm::vec2 previousPosition;
-        glm::vec3 initialScale;
-        float initialZRotation;
+        /**
+         * @brief Position to render between two physics steps.
+         * @param alpha Fraction of a physics step passed since the last one, see PhysicsSystem::getInterpolationAlpha.
+         * @return previousPosition blended towards position.
+         */
+        [[nodiscard]] glm::vec3 getInterpolatedPosition(const float alpha) const
+        {
+            return {glm::mix(previousPosition, glm::vec2(position), alpha), position.z};
+        }
+
         glm::vec3 position;
         glm::vec3 scale;
+        glm::vec2 previousPosition; ///< Position before the last physics step, set it with position when teleporting.
         float zRotation;
         float parallaxFactor;
     };
 
+    /**
+     * @brief The transform an entity was created with.
+     *
+     * Kept apart from TransformComponent, so views over the current transforms don't pull these into the cache.
+     * Only read when a level is reset or a body is (re)built from the level layout.
+     */
+    struct InitialTransformComponent
+    {
+        glm::vec3 position = {0.0f, 0.0f, 0.0f};
+        glm::vec3 scale = {1.0f, 1.0f, 1.0f};
+        float zRotation = 0.0f;
+    };
+
     /**
      * @brief Component storing rendering data for an entity.
      *
-     * Includes shader, mesh, colors, texture, UV mapping, and active state.
-     * Used by the rendering system to draw the entity.
+     * Includes shape of the shared unit mesh, color, texture, UV mapping, and active state.
+     * Used by the rendering system to draw the entity, custom shaders are in a CustomShaderComponent.
      */
     struct RenderComponent
     {
-        rendering::Shader shader;
-        rendering::Mesh mesh;
+        const rendering::Texture* texture = nullptr; /**< Own texture or atlas page holding the image. */
         glm::vec4 color = {1.0f, 0.0f, 0.0f, 1.0f}; /**< Base color tint (default red), used if not using texture. */
-        glm::vec4 gradientTopColor = {1, 1, 1, 1}; /**< Top color for gradient effects. */
-        glm::vec4 gradientBottomColor = {1, 1, 1, 1}; /**< Bottom color for gradient effects. */
-        const rendering::Texture* texture = nullptr;
-        bool repeatX = false; /**< If the texture is repeated on x */
-        float repeatAmount = 0.f; /**< How often the texture is repeated on x */
-        glm::vec4 uv; /**< UV coordinates for texture mapping. */
+        glm::vec4 atlasRect = {0.f, 0.f, 1.f, 1.f}; /**< Rect of the image inside the texture, uvs are local to it. */
+        glm::vec4 uv = {0.f, 0.f, 1.f, 1.f}; /**< UV coordinates for texture mapping. */
         glm::vec2 uvOffset = {0.0f, 0.0f}; /**< Offset applied to UV mapping. */
+        float repeatAmount = 0.f; /**< How often the texture is repeated on x */
+        rendering::SpriteShape shape = rendering::SpriteShape::Quad; /**< Unit shape of the mesh. */
+        bool repeatX = false; /**< If the texture is repeated on x */
+        bool isBatched = true; /**< Has no CustomShaderComponent and can be drawn through the SpriteBatch. */
         bool isActive = true;
+
+        /**
+         * @brief UV rect (u_min, v_min, u_max, v_max) the unit mesh is mapped onto.
+         * Quads repeating their texture on x reach from uv.x to uv.x + repeatAmount, triangles never repeat.
+         */
+        [[nodiscard]] glm::vec4 getUvRect() const
+        {
+            const float rightU = shape == rendering::SpriteShape::Quad && repeatAmount > 0.f
+                                     ? uv.x + repeatAmount
+                                     : uv.z;
+            return {uv.x, uv.y, rightU, uv.w};
+        }
+    };
+
+    /**
+     * @brief Shader of an entity that isn't drawn with the default sprite shaders.
+     *
+     * Only entities with custom shaders (e.g. the gradient sky) have one, batched sprites don't carry a shader.
+     */
+    struct CustomShaderComponent
+    {
+        rendering::ShaderHandle shader; /**< Shared program from the ShaderCache. */
+        rendering::CustomShaderUniforms uniforms; /**< The program's uniforms, resolved when it was loaded. */
+        glm::vec4 gradientTopColor = {1, 1, 1, 1}; /**< Top color for gradient effects. */
+        glm::vec4 gradientBottomColor = {1, 1, 1, 1}; /**< Bottom color for gradient effects. */
     };
 
     /**
@@ -124,17 +175,6 @@ namespace gl3::engine::ecs
         bool isActive = true;
     };
 
-    /**
-     * @brief Component to assign a string tag to an entity.
-     *
-     * Used to identify or categorize entities by a human-readable tag.
-     * The default tag value is "undefined".
-     */
-    struct TagComponent
-    {
-        std::string tag = "undefined";
-    };
-
     /**
      *Provides methods and helpers to create and delete enTT entity (either quad or triangle) with basic components.
      */
@@ -161,20 +201,29 @@ namespace gl3::engine::ecs
             registry.emplace<TransformComponent>(
                 entity, object.position, object.scale, object.zRotation, object.parallaxFactor
             );
-            registry.emplace<TagComponent>(entity, object.tag);
+            registry.emplace<InitialTransformComponent>(entity, object.position, object.scale, object.zRotation);
+            const TagId tag = TagRegistry::intern(object.tag);
+            registry.emplace<TagComponent>(entity, tag);
+            emplaceTagComponents(registry, entity, tag);
             if (object.generatePhysicsComp)
             {
                 registry.emplace<PhysicsComponent>(
                     entity, createPhysicsBody(physicsWorld, entity, object)
                 );
             }
-            const rendering::Texture* tex = object.textureName.empty()
-                                                ? nullptr
-                                                : rendering::TextureManager::getTileOrSingleTex(object.textureName);
+            const rendering::TextureRegion* tex = object.textureName.empty()
+                                                      ? nullptr
+                                                      : rendering::TextureManager::getTileOrSingleTex(
+                                                          object.textureName);
             if (object.generateRenderComp)
             {
+                auto customShader = createCustomShaderComponent(object);
+                if (customShader)
+                {
+                    registry.emplace<CustomShaderComponent>(entity, std::move(*customShader));
+                }
                 registry.emplace<RenderComponent>(
-                    entity, createRenderComponent(object, tex));
+                    entity, createRenderComponent(object, tex, !customShader));
             }
 
             return entity;
@@ -306,12 +355,12 @@ namespace gl3::engine::ecs
          */
         static void setScale(entt::registry& registry, const entt::entity& entity, const glm::vec3& newScale)
         {
-            const auto& tag_comp = registry.get<TagComponent>(entity);
             auto& transform = registry.get<TransformComponent>(entity);
             const auto& physics_comp = registry.get<PhysicsComponent>(entity);
             transform.scale = newScale;
-            const auto polygon = createPolygon(tag_comp.tag == "obstacle", transform.scale.x, transform.scale.y);
+            const auto polygon = createPolygon(registry.all_of<ObstacleTag>(entity), transform.scale.x, transform.scale.y);
             b2Shape_SetPolygon(physics_comp.shape, &polygon);
+            registry.patch<TransformComponent>(entity);
         };
 
         /**
@@ -325,8 +374,11 @@ namespace gl3::engine::ecs
             auto& transform = registry.get<TransformComponent>(entity);
             const auto& physics_comp = registry.get<PhysicsComponent>(entity);
             transform.position = newPos;
+            // Teleports, rendering should not blend from the old position
+            transform.previousPosition = newPos;
             b2Body_SetTransform(physics_comp.body, b2Vec2(transform.position.x, transform.position.y),
                                 b2Body_GetRotation(physics_comp.body));
+            registry.patch<TransformComponent>(entity);
         }
 
         /**
@@ -342,66 +394,19 @@ namespace gl3::engine::ecs
             transform.zRotation = newZRot;
             b2Body_SetTransform(physics_comp.body, b2Body_GetPosition(physics_comp.body),
                                 b2MakeRot(glm::radians(newZRot)));
-        }
-
-        struct glData
-        {
-            std::vector<float> vertices;
-            std::vector<unsigned int> indices;
-        };
-
-        static glData getTriangleVertices(const float& width, const float& height, const glm::vec4& uv)
-        {
-            glData triangleData;
-
-            float uMid = (uv.x + uv.z) * 0.5f;
-            float vTop = uv.w;
-            float vBottom = uv.y;
-
-            // Triangle vertices (x, y, z)
-            triangleData.vertices = {
-                -width / 2, -height / 2, 0.0f, uv.x, vBottom, // Bottom-left
-                width / 2, -height / 2, 0.0f, uv.z, vBottom, // Bottom-right
-
-                0.0f, height / 2, 0.0f, uMid, vTop // Top-center
-            };
-
-            // Indices for one triangle
-            triangleData.indices = {
-                0, 1, 2 // The triangle
-            };
-
-            return triangleData;
-        }
-
-        static glData getBoxVertices(const float width, const float height, glm::vec4 uv, const float repeatX)
-        {
-            glData boxData;
-
-            float leftU = uv.x;
-            float rightU = repeatX > 0.f ? uv.x + repeatX : uv.z;
-
-            boxData.vertices = {
-                -width / 2, height / 2, 0.0f, leftU, uv.w,
-                -width / 2, -height / 2, 0.0f, leftU, uv.y,
-                width / 2, -height / 2, 0.0f, rightU, uv.y,
-                width / 2, height / 2, 0.0f, rightU, uv.w
-            };
-            boxData.indices = {
-                0, 1, 2,
-                0, 2, 3
-            };
-            return boxData;
+            registry.patch<TransformComponent>(entity);
         }
 
         /**
          * Creates a RenderComponent from properties in @param object to render an entity from in the RenderingSystem.
          * @param object The GameObject holding the properties for generating the RenderComponent
-         * @param texture A pointer to a texture, is null_ptr if a color should be used instead
+         * @param texture A pointer to a texture region, is null_ptr if a color should be used instead
+         * @param isBatched False if the entity has a CustomShaderComponent, @see createCustomShaderComponent
          * @return The newly created RenderComponent for an entity.
          */
-        static RenderComponent createRenderComponent(GameObject& object,
-                                                     const rendering::Texture* texture)
+        static RenderComponent createRenderComponent(const GameObject& object,
+                                                     const rendering::TextureRegion* texture,
+                                                     const bool isBatched = true)
         {
             float repeatXMultiplier = 1.f;
             if (texture)
@@ -409,41 +414,64 @@ namespace gl3::engine::ecs
                 if (object.repeatTextureX)
                 {
                     //repeat texture on x to keep textures aspect ratio
-                    const float texAspect = static_cast<float>(texture->getWidth()) / static_cast<float>(texture->getHeight());
+                    const float texAspect = static_cast<float>(texture->width) / static_cast<float>(texture->height);
                     repeatXMultiplier = object.scale.x / (object.scale.y * texAspect);
                 } else
                 {
                     repeatXMultiplier = 0.f;
                 }
             }
+            RenderComponent renderComp;
+            renderComp.texture = texture ? texture->texture : nullptr;
+            renderComp.color = object.color;
+            renderComp.atlasRect = texture ? texture->rect : glm::vec4(0.f, 0.f, 1.f, 1.f);
+            renderComp.uv = object.uv;
+            renderComp.repeatAmount = repeatXMultiplier;
+            renderComp.shape = object.isTriangle ? rendering::SpriteShape::Triangle : rendering::SpriteShape::Quad;
+            renderComp.repeatX = object.repeatTextureX;
+            renderComp.isBatched = isBatched;
+            return renderComp;
+        }
+
+        /**
+         * Creates the shader component of an entity that doesn't use the default sprite shaders.
+         * @param object The GameObject holding the shader paths and gradient colors, gets the gradient shaders assigned
+         * if its gradient colors differ.
+         * @return The CustomShaderComponent, or std::nullopt if the entity can be drawn through the SpriteBatch.
+         */
+        static std::optional<CustomShaderComponent> createCustomShaderComponent(GameObject& object)
+        {
             //use gradient shader
             if (!all(epsilonEqual(object.gradientTopColor, object.gradientBottomColor, 0.001f)))
             {
                 object.vertexShaderPath = "shaders/gradient.vert";
                 object.fragmentShaderPath = "shaders/gradient.frag";
             }
-            const auto data = object.isTriangle
-                                  ? getTriangleVertices(1.f, 1.f, object.uv)
-                                  : getBoxVertices(1.f, 1.f, object.uv, repeatXMultiplier);
-            const std::vector<float> vertices = data.vertices;
-            const std::vector<unsigned int> indices = data.indices;
             const std::string vertexPath = !object.vertexShaderPath.empty()
                                                ? object.vertexShaderPath
                                                : "shaders/vertexShader.vert";
             const std::string fragmentPath = !object.fragmentShaderPath.empty()
                                                  ? object.fragmentShaderPath
                                                  : "shaders/fragmentShader.frag";
-            return RenderComponent(
-                rendering::Shader(vertexPath, fragmentPath),
-                rendering::Mesh(vertices, indices),
-                object.color,
-                object.gradientTopColor,
-                object.gradientBottomColor,
-                texture,
-                object.repeatTextureX,
-                repeatXMultiplier,
-                object.uv
-            );
+            // Only entities with the default shaders can be drawn as instanced sprites
+            if (vertexPath == "shaders/vertexShader.vert" && fragmentPath == "shaders/fragmentShader.frag")
+            {
+                return std::nullopt;
+            }
+            auto shader = rendering::ShaderCache::get(vertexPath, fragmentPath);
+            // Report uniforms the RenderingSystem relies on once at load, not every frame
+            if (object.vertexShaderPath == "shaders/gradient.vert")
+            {
+                shader->expectUniforms({"model", "topColor", "bottomColor"});
+            }
+            else
+            {
+                shader->expectUniforms({"model"});
+            }
+            const rendering::CustomShaderUniforms uniforms(*shader);
+            return CustomShaderComponent{
+                std::move(shader), uniforms, object.gradientTopColor, object.gradientBottomColor
+            };
         }
 
         /**
@@ -456,38 +484,98 @@ namespace gl3::engine::ecs
         static PhysicsComponent createPhysicsBody(const b2WorldId& physicsWorld,
                                                   const entt::entity& entity,
                                                   const GameObject& object)
+        {
+            const b2BodyDef bodyDef = createBodyDef(entity, object);
+            const auto body = b2CreateBody(physicsWorld, &bodyDef);
+
+            const bool isPlayer = hashTag(object.tag) == tags::player;
+            std::vector<b2ShapeId> sensors;
+            if (isPlayer)
+            {
+                //create additional sensors for player ground and collision checks.
+                sensors = createSensors(object, body);
+            }
+
+            const b2ShapeId shape = createShape(body, object);
+
+            return isPlayer
+                       ? PhysicsComponent(physicsWorld, body, shape, sensors)
+                       : PhysicsComponent(physicsWorld, body, shape);
+        };
+
+        /**
+         * Describes the Box2D body of an entity, set by properties from @param object
+         * @param entity The entity stored as the body's user data.
+         * @param object The GameObject from which to take parameters like position.
+         * @return The body definition.
+         */
+        static b2BodyDef createBodyDef(const entt::entity& entity, const GameObject& object)
         {
             b2BodyDef bodyDef = b2DefaultBodyDef();
-            bodyDef.type = object.tag == "player" ? b2_dynamicBody : b2_kinematicBody;
+            // Level geometry stays in place while the camera scrolls, static bodies are cheapest in the broadphase
+            const bool isPlayer = hashTag(object.tag) == tags::player;
+            bodyDef.type = isPlayer ? b2_dynamicBody : b2_staticBody;
             bodyDef.position = {object.position.x, object.position.y};
             bodyDef.rotation = b2MakeRot(glm::radians(object.zRotation));
-            bodyDef.fixedRotation = object.tag == "player";
-            bodyDef.isBullet = object.tag == "player"; //stop tunneling / continuously update collision detection
+            bodyDef.fixedRotation = isPlayer;
+            bodyDef.isBullet = isPlayer; //stop tunneling / continuously update collision detection
             bodyDef.linearDamping = 0.0f;
             bodyDef.userData = reinterpret_cast<void*>(static_cast<uintptr_t>(entity));
-            const auto body = b2CreateBody(physicsWorld, &bodyDef);
+            return bodyDef;
+        }
 
+        /**
+         * Creates the main collision shape of an entity on its body.
+         * @param body The body to attach the shape to.
+         * @param object The GameObject from which to take parameters like scale.
+         * @return The newly created shape.
+         */
+        static b2ShapeId createShape(const b2BodyId body, const GameObject& object)
+        {
             b2ShapeDef shapeDef = b2DefaultShapeDef();
             shapeDef.density = 0.f;
             shapeDef.friction = 0.0f;
             shapeDef.restitution = 0.0f;
             shapeDef.isSensor = object.isSensor;
-
-            std::vector<b2ShapeId> sensors;
-            if (object.tag == "player")
-            {
-                //create additional sensors for player ground and collision checks.
-                sensors = createSensors(object, body);
-            }
+            // Contact events resolve the entity and the kind of hit from the shape alone
+            shapeDef.userData = b2Body_GetUserData(body);
+            const TagId tag = hashTag(object.tag);
+            shapeDef.filter = physics::makeCollisionFilter(tag);
+            // Box2D only reports begin events if one of the two shapes asks for them, any touch of the player's main
+            // shape with an obstacle has to reach the PlayerContactListener
+            shapeDef.enableContactEvents = tag == tags::player || tag == tags::obstacle;
 
             const b2Polygon polygon = createPolygon(object.isTriangle, object.scale.x,
                                                     object.scale.y);
-            const b2ShapeId shape = b2CreatePolygonShape(body, &shapeDef, &polygon);
+            return b2CreatePolygonShape(body, &shapeDef, &polygon);
+        }
 
-            return object.tag == "player"
-                       ? PhysicsComponent(physicsWorld, body, shape, sensors)
-                       : PhysicsComponent(physicsWorld, body, shape);
-        };
+        /**
+         * Creates the shape of a grouped child on its parent's body.
+         * @param parentBody The body of the group parent.
+         * @param child The child entity, stored as the shape's user data.
+         * @param tag The child's tag, picks the shape's collision category.
+         * @param localOffset The child's offset to the parent.
+         * @param scale The child's scale.
+         * @param zRotation The child's z rotation.
+         * @return The newly created shape.
+         */
+        static b2ShapeId createGroupChildShape(const b2BodyId parentBody, const entt::entity child, const TagId tag,
+                                               const glm::vec2& localOffset, const glm::vec2& scale,
+                                               const float zRotation)
+        {
+            b2ShapeDef shapeDef = b2DefaultShapeDef();
+            shapeDef.userData = physics::toShapeUserData(child);
+            shapeDef.filter = physics::makeCollisionFilter(tag);
+            shapeDef.enableContactEvents = tag == tags::obstacle;
+            const b2Polygon polygon = b2MakeOffsetBox(
+                scale.x * 0.5f,
+                scale.y * 0.5f,
+                {localOffset.x, localOffset.y},
+                b2MakeRot(zRotation)
+            );
+            return b2CreatePolygonShape(parentBody, &shapeDef, &polygon);
+        }
 
         /**
          *
@@ -532,6 +620,12 @@ namespace gl3::engine::ecs
             b2ShapeDef groundSensorDef = b2DefaultShapeDef();
             b2ShapeDef rightSensorDef = b2DefaultShapeDef();
             b2ShapeDef topSensorDef = b2DefaultShapeDef();
+            // All player shapes share the player category, the contact listener tells them apart by id
+            for (b2ShapeDef* def : {&groundSensorDef, &rightSensorDef, &topSensorDef})
+            {
+                def->userData = b2Body_GetUserData(playerBody);
+                def->filter = physics::makeCollisionFilter(tags::player);
+            }
 
             // ground sensor
             groundSensorDef.isSensor = true;
@@ -9,11 +9,6 @@
 namespace gl3::engine::ecs
 {
     /**
- * Signal that instances to render have changed for back to front sorting.
- */
-    struct RenderComponentContainerChange{};
-
-    /**
     * Use GameStateChange event to track your current game state, and react to it changing.
     *@property newLevelIndex is used for GameState::Level
      */
@@ -34,6 +29,26 @@ namespace gl3::engine::ecs
         float finalBeatIndex = 0.f;
     };
 
+    /**
+     * Steps of loading a level, in the order they finish.
+     */
+    enum class LevelLoadStage
+    {
+        ReadingLevel, ///< Reading and parsing the level file on a worker thread.
+        CreatingEntities, ///< Creating entities, bodies and shaders on the main thread, a few per frame.
+        AnalyzingAudio, ///< Waiting for the worker thread opening and analyzing the level's audio.
+        Done ///< The level is ready to play.
+    };
+
+    /**
+    * Sent every frame while a level loads, e.g. to animate a loading screen.
+    */
+    struct LevelLoadProgress
+    {
+        LevelLoadStage stage = LevelLoadStage::ReadingLevel;
+        float progress = 0.f; ///< Overall progress from 0 to 1.
+    };
+
     /**
     * Call this event, when the level is loaded and ready to play.
     *
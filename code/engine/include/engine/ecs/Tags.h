@@ -0,0 +1,142 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <entt/entt.hpp>
+#include "engine/FileFingerprint.h"
+
+namespace gl3::engine::ecs
+{
+    /// Interned tag, the hash of the tag string.
+    using TagId = uint32_t;
+
+    /**
+     * @brief Hash a tag string at compile time or runtime (low 32 bits of the 64 bit FNV-1a hash).
+     * @param tag The tag string, as written in level files.
+     * @return The tag's id.
+     */
+    constexpr TagId hashTag(const std::string_view tag)
+    {
+        return static_cast<TagId>(FileFingerprint::hash(tag));
+    }
+
+    /**
+     * @brief Ids of the tags the engine and game know about.
+     */
+    namespace tags
+    {
+        constexpr TagId undefined = hashTag("undefined");
+        constexpr TagId player = hashTag("player");
+        constexpr TagId obstacle = hashTag("obstacle");
+        constexpr TagId platform = hashTag("platform");
+        constexpr TagId gravity = hashTag("gravity");
+        constexpr TagId visual = hashTag("visual");
+        constexpr TagId ground = hashTag("ground");
+        constexpr TagId sky = hashTag("sky");
+        constexpr TagId background = hashTag("background");
+    }
+
+    /**
+     * @class TagRegistry
+     * @brief Maps tag strings to their TagId and back.
+     *
+     * Strings are only looked at when entities are created from level data, everything at runtime works on ids or
+     * on the empty tag components below.
+     */
+    class TagRegistry
+    {
+    public:
+        /**
+         * @brief Get the id of a tag string and remember the string for getName().
+         * @param tag The tag string.
+         * @return The tag's id.
+         * @throws std::runtime_error If a different string already has the same id.
+         */
+        static TagId intern(std::string_view tag);
+
+        /**
+         * @param id An interned tag id.
+         * @return The tag's string, "undefined" for unknown ids.
+         */
+        static const std::string& getName(TagId id);
+
+    private:
+        static std::unordered_map<TagId, std::string> names;
+    };
+
+    /**
+     * @brief Component to assign a tag to an entity.
+     *
+     * Used to identify or categorize entities. Built-in tags also get an empty tag component (e.g. PlayerTag),
+     * prefer filtering views by those.
+     */
+    struct TagComponent
+    {
+        TagId id = tags::undefined;
+
+        /// @return The tag string, e.g. for saving or debug output.
+        [[nodiscard]] const std::string& getName() const { return TagRegistry::getName(id); }
+    };
+
+    struct PlayerTag {}; ///< Tag component of the "player" entity.
+    struct ObstacleTag {}; ///< Tag component of "obstacle" entities, kill the player on contact.
+    struct PlatformTag {}; ///< Tag component of "platform" entities.
+    struct GravityTag {}; ///< Tag component of "gravity" entities, sensors flipping gravity.
+    struct VisualTag {}; ///< Tag component of "visual" entities.
+    struct GroundTag {}; ///< Tag component of "ground" entities.
+    struct SkyTag {}; ///< Tag component of "sky" entities.
+    struct BackgroundTag {}; ///< Tag component of "background" entities.
+
+    /// Obstacles, platforms, gravity changers and visuals: the level layout moving past the player.
+    struct LevelObjectTag {};
+
+    /// Ground, sky and backgrounds: fitted to the window instead of being part of the level layout.
+    struct BackdropTag {};
+
+    /**
+     * @brief Add the empty tag components of a built-in tag to an entity. Unknown tags add nothing.
+     * @param registry The current enTT registry.
+     * @param entity The entity.
+     * @param id The entity's tag.
+     */
+    inline void emplaceTagComponents(entt::registry& registry, const entt::entity entity, const TagId id)
+    {
+        switch (id)
+        {
+        case tags::player:
+            registry.emplace<PlayerTag>(entity);
+            break;
+        case tags::obstacle:
+            registry.emplace<ObstacleTag>(entity);
+            registry.emplace<LevelObjectTag>(entity);
+            break;
+        case tags::platform:
+            registry.emplace<PlatformTag>(entity);
+            registry.emplace<LevelObjectTag>(entity);
+            break;
+        case tags::gravity:
+            registry.emplace<GravityTag>(entity);
+            registry.emplace<LevelObjectTag>(entity);
+            break;
+        case tags::visual:
+            registry.emplace<VisualTag>(entity);
+            registry.emplace<LevelObjectTag>(entity);
+            break;
+        case tags::ground:
+            registry.emplace<GroundTag>(entity);
+            registry.emplace<BackdropTag>(entity);
+            break;
+        case tags::sky:
+            registry.emplace<SkyTag>(entity);
+            registry.emplace<BackdropTag>(entity);
+            break;
+        case tags::background:
+            registry.emplace<BackgroundTag>(entity);
+            registry.emplace<BackdropTag>(entity);
+            break;
+        default:
+            break;
+        }
+    }
+}
@@ -5,7 +5,7 @@
 #pragma once
 #include "EditorSystem.h"
 #include "engine/Constants.h"
-#include "engine/rendering/Texture.h"
+#include "engine/rendering/TextureAtlas.h"
 #include "engine/Game.h"
 #include "engine/ecs/GameEvents.h"
 #include "engine/levelloading/Objects.h"
@@ -100,20 +100,20 @@ namespace gl3::engine::editor
 
         /**
          * @brief Visualizes a tileset texture in the UI.
-         * @param texture The texture representing the tileset.
+         * @param texture The texture region representing the tileset.
          * @param name Name/title of the tileset.
          * @param tileSize Size of each tile in the UI.
          */
-        void visualizeTileSetUI(const rendering::Texture& texture, const std::string& name,
+        void visualizeTileSetUI(const rendering::TextureRegion& texture, const std::string& name,
                                 float tileSize);
 
         /**
          * @brief Visualizes a single texture in the UI.
-         * @param texture The texture to display.
+         * @param texture The texture region to display.
          * @param name Name of the texture.
          * @param tileSize Display size for the texture.
          */
-        void visualizeSingleTextureUI(const rendering::Texture& texture, const std::string& name,
+        void visualizeSingleTextureUI(const rendering::TextureRegion& texture, const std::string& name,
                                       float tileSize);
 
         /**
@@ -0,0 +1,109 @@
+#pragma once
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include "Objects.h"
+
+namespace gl3::engine::levelLoading
+{
+    /**
+     * @brief File header of a binary level (.lvlb).
+     *
+     * Layout: header, then the Level in glaze's BEVE format (same keys as the JSON files).
+     */
+    struct LevelFileHeader
+    {
+        static constexpr uint32_t expectedMagic = 0x424C564C; ///< "LVLB" in little endian.
+        static constexpr uint32_t currentVersion = 2;
+
+        uint32_t magic = expectedMagic;
+        uint32_t version = currentVersion;
+        uint64_t sourceSize = 0; ///< Size of the level's JSON file in bytes, to detect outdated binaries.
+        uint64_t sourceHash = 0; ///< FNV-1a hash of the JSON file.
+        int64_t sourceWriteTime = 0; ///< Last write time of the JSON file when it was last hashed.
+    };
+
+    /**
+     * @class LevelFile
+     * @brief Reads and writes levels as JSON or as binary .lvlb files.
+     *
+     * JSON stays the format levels are edited and exchanged in. The binary version next to it is written on save and
+     * by the LevelConverter tool, and is loaded straight from a memory mapping instead of parsing text.
+     */
+    class LevelFile
+    {
+    public:
+        /// File extension of binary levels.
+        static constexpr auto binaryExtension = ".lvlb";
+
+        /**
+         * @brief Load a level, from its binary version if there is an up to date one.
+         *
+         * The binary version is up to date if it has the JSON file's size and write time. If only the write time
+         * differs (e.g. the level was copied), the JSON file is hashed: the binary version is used and its write time
+         * refreshed if the content is unchanged, otherwise the JSON file is loaded.
+         * @param jsonPath Path to the level's JSON file (e.g. assets/levels/Forces.json).
+         * @return The level.
+         * @throws std::runtime_error If neither file can be read.
+         */
+        static Level read(const std::filesystem::path& jsonPath);
+
+        /**
+         * @brief Parse a level JSON file.
+         * @param path Path to the JSON file.
+         * @return The level.
+         * @throws std::runtime_error If the file can't be opened or parsed.
+         */
+        static Level readJson(const std::filesystem::path& path);
+
+        /**
+         * @brief Map and read a binary level.
+         * @param path Path to the .lvlb file.
+         * @return The level.
+         * @throws std::runtime_error If the file can't be mapped or is not a valid binary level.
+         */
+        static Level readBinary(const std::filesystem::path& path);
+
+        /**
+         * @brief Serialize a level to JSON.
+         * @param level The level.
+         * @return The JSON text.
+         * @throws std::runtime_error If the level can't be serialized.
+         */
+        static std::string toJson(const Level& level);
+
+        /**
+         * @brief Write a level as a binary level.
+         * @param level The level.
+         * @param sourceSize Size of the level's JSON file in bytes.
+         * @param sourceHash FNV-1a hash of the level's JSON file, @see FileFingerprint::hash
+         * @param sourceWriteTime Last write time of the level's JSON file, @see FileFingerprint::getWriteTime
+         * @param path Destination path.
+         * @throws std::runtime_error If the level can't be serialized or the file can't be written.
+         */
+        static void writeBinary(const Level& level, uint64_t sourceSize, uint64_t sourceHash, int64_t sourceWriteTime,
+                                const std::filesystem::path& path);
+
+        /**
+         * @brief Write a level's JSON file and its binary version next to it.
+         * @param level The level.
+         * @param jsonPath Path to the JSON file.
+         * @throws std::runtime_error If the level can't be serialized or a file can't be written.
+         */
+        static void writeJsonAndBinary(const Level& level, const std::filesystem::path& jsonPath);
+
+        /**
+         * @brief Read the header of a binary level without mapping it.
+         * @param path Path to the .lvlb file.
+         * @param header Receives the header.
+         * @return False if the file doesn't exist or has no valid header.
+         */
+        static bool readHeader(const std::filesystem::path& path, LevelFileHeader& header);
+
+        /**
+         * @param jsonPath Path to a level's JSON file.
+         * @return Path of its binary version, in the same folder.
+         */
+        static std::filesystem::path binaryPathFor(const std::filesystem::path& jsonPath);
+    };
+}
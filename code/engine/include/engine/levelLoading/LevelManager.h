@@ -44,6 +44,34 @@ namespace gl3::engine::levelLoading
          */
         static Level* loadLevelByID(int ID);
 
+        /**
+         * @brief Reads a level from disk without adding it to the loaded levels.
+         *
+         * Only reads the level metadata, so it can run on a worker thread while the main thread keeps going.
+         * Hand the result to addLoadedLevel on the main thread.
+         *
+         * @param ID Unique identifier of the level to read.
+         * @return The level, or runtime error if not found or failed to load.
+         */
+        static std::unique_ptr<Level> readLevelByID(int ID);
+
+        /**
+         * @brief Adds a level read with readLevelByID to the loaded levels and makes it the current level.
+         *
+         * If the level got loaded in the meantime, the already loaded version is kept.
+         *
+         * @param ID Unique identifier of the level.
+         * @param level The level.
+         * @return Pointer to the loaded Level object.
+         */
+        static Level* addLoadedLevel(int ID, std::unique_ptr<Level> level);
+
+        /**
+         * @param ID Unique identifier of a level.
+         * @return True if the level is already loaded, loadLevelByID then returns it without reading the disk.
+         */
+        static bool isLevelLoaded(const int ID) { return loaded_levels.contains(ID); }
+
         /**
          * @brief Adds a game object to the currently loaded level.
          *
@@ -104,8 +132,6 @@ namespace gl3::engine::levelLoading
         static std::unordered_map<int, std::unique_ptr<Level>> loaded_levels;
         ///< Map of loaded levels by ID  @note Put your level json files in assets/levels
         static std::unordered_map<int, std::string> idToFilename; ///< Mapping of level IDs to filenames.
-        static Level* loadLevel(int ID, const std::string& filename);
-        ///< Internal helper to load level from file. @note Put your level json files in assets/levels
         static int most_recent_loaded_lvl_ID; ///< ID of the last loaded level.
     };
 }
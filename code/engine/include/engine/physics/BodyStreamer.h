@@ -0,0 +1,126 @@
+#pragma once
+#include <vector>
+#include <box2d/box2d.h>
+#include <entt/entt.hpp>
+#include "engine/ecs/EntityFactory.h"
+
+namespace gl3::engine::physics
+{
+    /**
+     * @brief Component of an entity whose Box2D body is only created while it is near the camera.
+     * @see BodyStreamer
+     */
+    struct StreamedBodyComponent
+    {
+        GameObject object; ///< Describes the body: position, scale, rotation, tag, sensor and triangle flags.
+        std::vector<entt::entity> children; ///< Grouped children, their shapes are attached to this body.
+        float minX = 0.f; ///< Left edge of the body and its children in world units.
+        float maxX = 0.f; ///< Right edge of the body and its children in world units.
+        bool isSpawned = false; ///< Has a body and a PhysicsComponent right now.
+    };
+
+    /**
+     * @class BodyStreamer
+     * @brief Creates Box2D bodies of static level geometry only inside a window around the camera.
+     *
+     * Entities registered with add() get their body and PhysicsComponent once they come within the look ahead
+     * distance of the window's right edge, and lose them again once they passed the look behind distance on the left.
+     * Freed bodies are disabled and kept in a pool for the next spawn. Memory and broadphase size are bounded by the
+     * window width instead of the level length.
+     * @note Only meant for geometry that does not move, the entities are indexed by their initial x extent.
+     */
+    class BodyStreamer
+    {
+    public:
+        /**
+         * @brief Create an empty streamer.
+         * @param lookAhead Distance in world units ahead of the window's right edge where bodies are created.
+         * @param lookBehind Distance in world units behind the window's left edge where bodies are freed.
+         */
+        explicit BodyStreamer(float lookAhead = 10.f, float lookBehind = 2.f);
+
+        /**
+         * @brief Register an entity whose body should be streamed, the body is not created yet.
+         * @param registry The current enTT registry.
+         * @param entity The entity, created without a PhysicsComponent.
+         * @param object The GameObject to create the body from.
+         */
+        void add(entt::registry& registry, entt::entity entity, const GameObject& object);
+
+        /**
+         * @brief Attach a grouped child to a streamed group parent, its shape is created with the parent's body.
+         * @param registry The current enTT registry.
+         * @param parent The registered group parent.
+         * @param child The child entity, has a PhysicsGroupChild and TransformComponent.
+         */
+        void addChild(entt::registry& registry, entt::entity parent, entt::entity child);
+
+        /**
+         * @brief Create the bodies entering and free the bodies leaving the window around the camera.
+         * Moving the window backwards (e.g. on a level restart) rescans the level once.
+         * @param registry The current enTT registry.
+         * @param physicsWorld The Box2D world to create the bodies in.
+         * @param windowLeft Left edge of the visible window in world units.
+         * @param windowRight Right edge of the visible window in world units.
+         */
+        void update(entt::registry& registry, b2WorldId physicsWorld, float windowLeft, float windowRight);
+
+        /**
+         * @brief Change how far around the window bodies exist, takes effect on the next update.
+         * @param lookAhead Distance in world units ahead of the window's right edge where bodies are created.
+         * @param lookBehind Distance in world units behind the window's left edge where bodies are freed.
+         */
+        void setDistances(float lookAhead, float lookBehind);
+
+        /// @return Distance ahead of the window's right edge where bodies are created.
+        [[nodiscard]] float getLookAhead() const { return look_ahead; }
+
+        /// @return Distance behind the window's left edge where bodies are freed.
+        [[nodiscard]] float getLookBehind() const { return look_behind; }
+
+        /**
+         * @brief Forget all registered entities, e.g. before the registry is cleared.
+         * Spawned bodies are left to their PhysicsComponents, pooled bodies are kept for the next level.
+         */
+        void clear();
+
+        /// @return Number of registered entities.
+        [[nodiscard]] size_t getStreamedCount() const { return entries.size(); }
+
+        /// @return Number of entities that currently have a body.
+        [[nodiscard]] size_t getSpawnedCount() const { return spawned.size(); }
+
+        /// @return Number of disabled bodies waiting for reuse.
+        [[nodiscard]] size_t getPooledCount() const { return pool.size(); }
+
+    private:
+        /**
+         * @brief A registered entity, ordered by its left edge.
+         */
+        struct Entry
+        {
+            float minX;
+            entt::entity entity;
+        };
+
+        /**
+         * @brief Give an entity a (pooled) body, its shapes and a PhysicsComponent.
+         */
+        void spawn(entt::registry& registry, b2WorldId physicsWorld, entt::entity entity,
+                   StreamedBodyComponent& streamed);
+
+        /**
+         * @brief Destroy the shapes of an entity's body, disable the body and return it to the pool.
+         */
+        void despawn(entt::registry& registry, entt::entity entity);
+
+        float look_ahead;
+        float look_behind;
+        std::vector<Entry> entries; ///< Sorted by minX once sorted is set.
+        bool sorted = true;
+        size_t next_entry = 0; ///< First entry not yet reached by the window's right edge.
+        float last_window_left = 0.f;
+        std::vector<entt::entity> spawned;
+        std::vector<b2BodyId> pool;
+    };
+}
@@ -0,0 +1,70 @@
+#pragma once
+#include <cstdint>
+#include <box2d/box2d.h>
+#include <entt/entt.hpp>
+#include "engine/ecs/Tags.h"
+
+namespace gl3::engine::physics
+{
+    /**
+     * @brief Box2D collision category bits of the shapes, picked from the entity's tag.
+     *
+     * Level objects only collide with the player (and untagged shapes), so the broadphase never pairs level geometry
+     * with itself and contact events tell what was hit without looking at the entities.
+     */
+    namespace collisionCategory
+    {
+        constexpr uint64_t Default = B2_DEFAULT_CATEGORY_BITS; ///< Shapes of other tags.
+        constexpr uint64_t Player = 0x0002;
+        constexpr uint64_t Obstacle = 0x0004; ///< Kills the player on contact.
+        constexpr uint64_t Platform = 0x0008; ///< Platforms, visuals and the ground.
+        constexpr uint64_t GravitySensor = 0x0010; ///< Flips gravity when the player passes.
+    }
+
+    /**
+     * @param tag The tag of the shape's entity.
+     * @return The collision category of a tag.
+     */
+    constexpr uint64_t getCollisionCategory(const ecs::TagId tag)
+    {
+        switch (tag)
+        {
+        case ecs::tags::player:
+            return collisionCategory::Player;
+        case ecs::tags::obstacle:
+            return collisionCategory::Obstacle;
+        case ecs::tags::platform:
+        case ecs::tags::visual:
+        case ecs::tags::ground:
+            return collisionCategory::Platform;
+        case ecs::tags::gravity:
+            return collisionCategory::GravitySensor;
+        default:
+            return collisionCategory::Default;
+        }
+    }
+
+    /**
+     * @param tag The tag of the shape's entity.
+     * @return The filter for a shape of an entity with this tag.
+     */
+    inline b2Filter makeCollisionFilter(const ecs::TagId tag)
+    {
+        b2Filter filter = b2DefaultFilter();
+        filter.categoryBits = getCollisionCategory(tag);
+        if (filter.categoryBits != collisionCategory::Player && filter.categoryBits != collisionCategory::Default)
+        {
+            filter.maskBits = collisionCategory::Player | collisionCategory::Default;
+        }
+        return filter;
+    }
+
+    /**
+     * @param entity The entity owning a shape.
+     * @return The value to store as the shape's user data.
+     */
+    inline void* toShapeUserData(const entt::entity entity)
+    {
+        return reinterpret_cast<void*>(static_cast<uintptr_t>(entity));
+    }
+}
@@ -1,8 +1,11 @@
 #pragma once
+#include "BodyStreamer.h"
 #include "PlayerContactListener.h"
 #include "engine/ecs/EntityFactory.h"
 #include "engine/ecs/System.h"
 #include "engine/Game.h"
+#include <algorithm>
+#include <cmath>
 #include <box2d/box2d.h>
 
 namespace gl3::engine::physics
@@ -39,12 +42,15 @@ namespace gl3::engine::physics
         event_t onAfterPhysicsStep;
 
         /**
-         * @brief Advances the physics simulation by the fixed timestep if enough time has elapsed.
+         * @brief Advances the physics simulation by as many fixed timesteps as have elapsed.
          *
+         * Runs up to MAX_STEPS_PER_FRAME steps, time beyond that is dropped so a long hitch can't snowball into ever
+         * longer frames. The remainder is kept for the next frame and rendering interpolates by it, see
+         * getInterpolationAlpha(). Each step:
+         * - Streams level bodies in and out around the camera (see BodyStreamer).
          * - Steps the Box2D world simulation.
          * - Checks for player collisions and contacts.
-         * - Updates transforms of entities with physics bodies.
-         * - Deactivates bodies that move outside the left window boundary.
+         * - Updates transforms of the entities whose bodies moved, using Box2D's body move events.
          * - Invokes after-step event and processes deletions of marked physics bodies.
          */
         void runPhysicsStep()
@@ -53,64 +59,27 @@ namespace gl3::engine::physics
                 return;
 
             accumulator += game.getDeltaTime();
-            if (accumulator < FIXED_TIME_STEP)
-                return;
-
-            auto& registry = game.getRegistry();
-            const b2WorldId world = game.getPhysicsWorld();
 
-            // Physics Step
-            b2World_Step(world, FIXED_TIME_STEP, SUB_STEP_COUNT);
-            PlayerContactListener::checkForPlayerCollision(registry, game.getPlayer(), world);
-
-            const float leftBound = game.getContext().getWorldWindowBounds()[0];
-
-            // Sync physics and parent components
-            const auto phyView = registry.view<
-                ecs::TransformComponent,
-                ecs::TagComponent,
-                ecs::PhysicsComponent
-            >();
-
-            for (const auto entity : phyView)
+            int steps = 0;
+            while (accumulator >= FIXED_TIME_STEP && steps < MAX_STEPS_PER_FRAME)
             {
-                auto& tc = phyView.get<ecs::TransformComponent>(entity);
-                auto& pc = phyView.get<ecs::PhysicsComponent>(entity);
-
-                if (!pc.isActive || !b2Body_IsValid(pc.body))
-                    continue;
-
-                if (registry.any_of<ecs::PhysicsGroupParent>(entity))
-                {
-                    updateParentPhysics(tc, pc);
-                    continue;
-                }
-
-                updateStandardPhysics(tc, pc, leftBound);
+                step();
+                accumulator -= FIXED_TIME_STEP;
+                ++steps;
             }
-
-            // Sync group children
-            const auto childView = registry.view<
-                ecs::PhysicsGroupChild,
-                ecs::TransformComponent
-            >();
-
-            for (auto [child, physChild, childTC] : childView.each())
+            if (accumulator >= FIXED_TIME_STEP)
             {
-                updateChildEntity(physChild, childTC, registry, leftBound);
-            }
-
-            // Cleanup
-            onAfterPhysicsStep.invoke();
-
-            if (player_jump_this_frame)
-            {
-                PlayerContactListener::playerGrounded = false;
-                player_jump_this_frame = false;
+                accumulator = std::fmod(accumulator, FIXED_TIME_STEP);
             }
+        }
 
-            processDeletions();
-            accumulator -= FIXED_TIME_STEP;
+        /**
+         * @return Fraction of a fixed timestep elapsed since the last physics step, in [0, 1).
+         * Rendering blends TransformComponent::previousPosition towards position by it.
+         */
+        [[nodiscard]] float getInterpolationAlpha() const
+        {
+            return std::clamp(accumulator / FIXED_TIME_STEP, 0.f, 1.f);
         }
 
         /**
@@ -131,91 +100,38 @@ namespace gl3::engine::physics
         }
 
         /**
-         * @brief Updates a group parent according to the physics step.
-         * @param tc TransformComponent of the parent entity.
-         * @param pc PhysicsComponent of the parent entity.
-         */
-        static void updateParentPhysics(
-            ecs::TransformComponent& tc,
-            const ecs::PhysicsComponent& pc)
-        {
-            b2Body_SetAwake(pc.body, true);
-            auto [p, q] = b2Body_GetTransform(pc.body);
-
-            tc.position.x = p.x;
-            tc.position.y = p.y;
-        }
-
-        /**
-         * @brief Updates entities according to the physics step.
-         * @param tc TransformComponent of the entity.
-         * @param pc PhysicsComponent of the entity.
-         * @param leftBound Left window bound for visibility check.
+         * @param move A body move event of the last physics step.
+         * @return The entity stored in the body's user data, see EntityFactory::createBodyDef.
          */
-        static void updateStandardPhysics(
-            ecs::TransformComponent& tc,
-            const ecs::PhysicsComponent& pc,
-            const float leftBound)
+        static entt::entity getMovedEntity(const b2BodyMoveEvent& move)
         {
-            const float rightEdge = tc.position.x + tc.scale.x * 0.5f;
-            const bool visible = rightEdge >= leftBound;
-
-            b2Body_SetAwake(pc.body, visible);
-
-            if (visible)
-            {
-                auto [p, q] = b2Body_GetTransform(pc.body);
-                tc.position.x = p.x;
-                tc.position.y = p.y;
-            }
+            return static_cast<entt::entity>(reinterpret_cast<uintptr_t>(move.userData));
         }
 
         /**
-         * @brief Updates group children according to their parent
-         * @param physChild PhysicsGroupChild component reference of the child entity.
-         * @param childTC TransformComponent of the child.
+         * @brief Copies a moved body's position to its entity, the entity is remembered for interpolation, see
+         * endInterpolation().
+         * @note Level geometry is static (see EntityFactory::createBodyDef), so only the player's body moves. Group
+         * children keep the transforms they were created with.
          * @param registry The current EnTT Registry.
-         * @param leftBound The left window bound for visibility checking.
+         * @param move The body move event.
          */
-        static void updateChildEntity(
-            ecs::PhysicsGroupChild& physChild,
-            ecs::TransformComponent& childTC,
-            entt::registry& registry,
-            const float leftBound)
+        void syncMovedBody(entt::registry& registry, const b2BodyMoveEvent& move)
         {
-            if (!registry.valid(physChild.root)) return;
-
-            if (!registry.all_of<ecs::TransformComponent, ecs::PhysicsComponent>(physChild.root))
-                return;
-
-            const auto& parentTC = registry.get<ecs::TransformComponent>(physChild.root);
-            auto& parentPhysComp = registry.get<ecs::PhysicsComponent>(physChild.root);
-
-            if (!parentPhysComp.isActive)
-                return;
-
-            if (const float rightEdge = childTC.position.x + childTC.scale.x * 0.5f; rightEdge >= leftBound)
-            {
-                const glm::vec3 offset = rotatedOffset(physChild.localOffset, parentTC.zRotation);
-                childTC.position = parentTC.position + offset;
-                childTC.zRotation = parentTC.zRotation;
-                return;
-            }
-
-            if (physChild.isActive)
-            {
-                auto& [bodyID, childCount, visibleChildren] = registry.get<ecs::PhysicsGroupParent>(physChild.root);
-                --visibleChildren;
-                physChild.isActive = false;
-
-                if (visibleChildren <= 0)
-                {
-                    parentPhysComp.isActive = false;
-                }
-            }
+            const entt::entity entity = getMovedEntity(move);
+            if (!registry.valid(entity)) return;
+
+            auto* tc = registry.try_get<ecs::TransformComponent>(entity);
+            auto* pc = registry.try_get<ecs::PhysicsComponent>(entity);
+            if (!tc || !pc || !pc->isActive) return;
+
+            tc->position.x = move.transform.p.x;
+            tc->position.y = move.transform.p.y;
+            interpolated_entities.push_back(entity);
+            // Lets listeners like the RenderQueue's spatial grid follow the moved transform
+            registry.patch<ecs::TransformComponent>(entity);
         }
 
-
         /**
          * @brief Marks a Box2D body for safe deletion after the physics step.
          * @param body The Box2D body to delete.
@@ -333,15 +249,78 @@ namespace gl3::engine::physics
             return result;
         }
 
+        /**
+         * @return The streamer creating level bodies around the camera, register static geometry with it.
+         */
+        BodyStreamer& getBodyStreamer() { return body_streamer; }
+
     private:
         static constexpr float FIXED_TIME_STEP = 1.0f / 60.0f; ///< Fixed physics timestep (60Hz)
         static constexpr int SUB_STEP_COUNT = 4; ///< Number of Box2D sub-steps per physics step
+        static constexpr int MAX_STEPS_PER_FRAME = 5; ///< Catch-up limit for slow frames
         float accumulator = 0.f; ///< Accumulates elapsed time to run fixed timestep
 
+        /// Entities moved by the last step, their previousPosition differs from position.
+        std::vector<entt::entity> interpolated_entities;
+
         bool player_jump_this_frame = false; ///< Tracks if player jumped this frame to update grounded state
 
         std::vector<b2BodyId> bodies_to_delete; ///< Bodies scheduled for deletion after physics step
 
+        BodyStreamer body_streamer; ///< Creates and recycles level bodies around the camera.
+
+        /**
+         * @brief Runs one fixed timestep, see runPhysicsStep().
+         */
+        void step()
+        {
+            auto& registry = game.getRegistry();
+            const b2WorldId world = game.getPhysicsWorld();
+            const auto& windowBounds = game.getContext().getWorldWindowBounds();
+            const float leftBound = windowBounds[0];
+
+            body_streamer.update(registry, world, leftBound, windowBounds[1]);
+
+            // Physics Step
+            b2World_Step(world, FIXED_TIME_STEP, SUB_STEP_COUNT);
+            PlayerContactListener::checkForPlayerCollision(registry, game.getPlayer(), world);
+
+            endInterpolation(registry);
+            // Only bodies that moved are reported, static and sleeping bodies cost nothing
+            const b2BodyEvents bodyEvents = b2World_GetBodyEvents(world);
+            for (int i = 0; i < bodyEvents.moveCount; ++i)
+            {
+                syncMovedBody(registry, bodyEvents.moveEvents[i]);
+            }
+
+            // Cleanup
+            onAfterPhysicsStep.invoke();
+
+            if (player_jump_this_frame)
+            {
+                PlayerContactListener::playerGrounded = false;
+                player_jump_this_frame = false;
+            }
+
+            processDeletions();
+        }
+
+        /**
+         * @brief Moves the previous positions of the entities moved by the last step up to their positions.
+         * Entities that stopped moving are not reported again, they would otherwise keep blending from a stale position.
+         */
+        void endInterpolation(entt::registry& registry)
+        {
+            for (const auto entity : interpolated_entities)
+            {
+                if (auto* tc = registry.valid(entity) ? registry.try_get<ecs::TransformComponent>(entity) : nullptr)
+                {
+                    tc->previousPosition = tc->position;
+                }
+            }
+            interpolated_entities.clear();
+        }
+
         /**
          * @brief Safely deletes all bodies marked for deletion after the physics step.
          */
@@ -1,6 +1,6 @@
 #pragma once
-#include <iostream>
 #include "box2d/box2d.h"
+#include "engine/physics/CollisionFilter.h"
 #include "engine/ecs/EntityFactory.h"
 #include "engine/ecs/EventDispatcher.h"
 #include "engine/ecs/GameEvents.h"
@@ -32,7 +32,7 @@ namespace gl3::engine::physics
          * - Inspects sensor begin touch events for the player’s ground and right wall sensors.
          * - Sets the `playerGrounded` flag when the ground sensor is triggered.
          * - Triggers a `PlayerDeath` event when the right wall sensor or obstacle is touched.
-         * - Iterates over physical contacts for the player body to check for collisions with obstacles.
+         * - Reads the contact begin/end events of the step, obstacles are recognized by their collision category.
          *
          * @param registry Reference to the ECS registry.
          * @param player The player entity to check collisions for.
@@ -46,17 +46,14 @@ namespace gl3::engine::physics
             const ecs::PhysicsComponent& physics_comp = registry.get<ecs::PhysicsComponent>(player);
             if(!b2Body_IsValid(physics_comp.body)) return;
 
-            const auto playerBody = physics_comp.body;
-
             const b2ShapeId playerGroundSensor = physics_comp.sensorShapes[0]; //sensor
             const b2ShapeId playerRightSensor = physics_comp.sensorShapes[1]; //collider
             const b2ShapeId playerTopSensor = physics_comp.sensorShapes[2]; //top sensor for driving on ceiling without having to rotate body
-            bool rightSensorHit = false;
 
             for (int i = 0; i < sensorEvents.beginCount; ++i)
             {
                 const b2SensorBeginTouchEvent& event = sensorEvents.beginEvents[i];
-                if (!b2Shape_IsValid(event.sensorShapeId) || !b2Shape_IsValid(event.sensorShapeId))
+                if (!b2Shape_IsValid(event.sensorShapeId) || !b2Shape_IsValid(event.visitorShapeId))
                     continue;
 
                 if (B2_ID_EQUALS(event.sensorShapeId, playerGroundSensor) || B2_ID_EQUALS(event.sensorShapeId, playerTopSensor))
@@ -64,14 +61,10 @@ namespace gl3::engine::physics
                     playerGrounded = true;
                 }
 
-                const auto sensorA = static_cast<entt::entity>(reinterpret_cast<uintptr_t>(
-                    b2Body_GetUserData(b2Shape_GetBody(event.sensorShapeId))));
-                auto& tagA = registry.get<ecs::TagComponent>(sensorA).tag;
-                const auto sensorB = static_cast<entt::entity>(reinterpret_cast<uintptr_t>(
-                    b2Body_GetUserData(b2Shape_GetBody(event.visitorShapeId))));
-                auto& tagB = registry.get<ecs::TagComponent>(sensorB).tag;
-                if (tagA != "player" && tagB != "player") continue;
-                if (tagA == "gravity" && !jumpMechanicTriggered)
+                const uint64_t sensorCategory = b2Shape_GetFilter(event.sensorShapeId).categoryBits;
+                const uint64_t visitorCategory = b2Shape_GetFilter(event.visitorShapeId).categoryBits;
+                if (((sensorCategory | visitorCategory) & collisionCategory::Player) == 0) continue;
+                if (sensorCategory == collisionCategory::GravitySensor && !jumpMechanicTriggered)
                 //a sensor object to set additional on jump logic (e.g. double jump)
                 {
                     ecs::EventDispatcher::dispatcher.trigger(ecs::GravityChange{event.sensorShapeId});
@@ -82,65 +75,72 @@ namespace gl3::engine::physics
             for (int i = 0; i < sensorEvents.endCount; ++i)
             {
                 const b2SensorEndTouchEvent& event = sensorEvents.endEvents[i];
-                if (!b2Shape_IsValid(event.sensorShapeId) || !b2Shape_IsValid(event.sensorShapeId))
+                if (!b2Shape_IsValid(event.sensorShapeId) || !b2Shape_IsValid(event.visitorShapeId))
                     continue;
 
-                const auto sensorA = static_cast<entt::entity>(reinterpret_cast<uintptr_t>(
-                    b2Body_GetUserData(b2Shape_GetBody(event.sensorShapeId))));
-                auto& tagA = registry.get<ecs::TagComponent>(sensorA).tag;
-                const auto sensorB = static_cast<entt::entity>(reinterpret_cast<uintptr_t>(
-                    b2Body_GetUserData(b2Shape_GetBody(event.visitorShapeId))));
-                auto& tagB = registry.get<ecs::TagComponent>(sensorB).tag;
-
-                if (tagA != "player" && tagB != "player") continue;
+                const uint64_t sensorCategory = b2Shape_GetFilter(event.sensorShapeId).categoryBits;
+                const uint64_t visitorCategory = b2Shape_GetFilter(event.visitorShapeId).categoryBits;
+                if (((sensorCategory | visitorCategory) & collisionCategory::Player) == 0) continue;
 
-                if (tagA == "gravity")
+                if (sensorCategory == collisionCategory::GravitySensor)
                 {
                     jumpMechanicTriggered = false; // ready for next time
                 }
             }
 
-            // Inspect direct body contacts
-            int capacity = b2Body_GetContactCapacity(playerBody);
-            capacity = b2MinInt(capacity, 4); // Cap to 4 for simplicity
-            b2ContactData contactData[4];
-            const int count = b2Body_GetContactData(playerBody, contactData, capacity);
+            // Only contacts that began or ended this step, level shapes never pair with each other (see CollisionFilter)
+            const b2ContactEvents contactEvents = b2World_GetContactEvents(physicsWorld);
+            if (!B2_ID_EQUALS(playerRightSensor, trackedRightSensor))
+            {
+                // A new player body, the end events of the old one's contacts don't match anymore
+                trackedRightSensor = playerRightSensor;
+                rightSensorContacts = 0;
+            }
 
-            for (int i = 0; i < count; ++i)
+            bool obstacleHit = false;
+            for (int i = 0; i < contactEvents.beginCount; ++i)
             {
-                const b2BodyId bodyIdA = b2Shape_GetBody(contactData[i].shapeIdA);
-                const b2BodyId bodyIdB = b2Shape_GetBody(contactData[i].shapeIdB);
+                const b2ContactBeginTouchEvent& event = contactEvents.beginEvents[i];
+                if (!b2Shape_IsValid(event.shapeIdA) || !b2Shape_IsValid(event.shapeIdB))
+                    continue;
 
-                const auto entityA = static_cast<entt::entity>(reinterpret_cast<uintptr_t>(
-                    b2Body_GetUserData(bodyIdA)));
-                const auto entityB = static_cast<entt::entity>(reinterpret_cast<uintptr_t>(
-                    b2Body_GetUserData(bodyIdB)));
+                const uint64_t categories = b2Shape_GetFilter(event.shapeIdA).categoryBits |
+                    b2Shape_GetFilter(event.shapeIdB).categoryBits;
+                if ((categories & collisionCategory::Player) == 0) continue;
 
-                if (!registry.valid(entityA) || !registry.valid(entityB))
+                if (B2_ID_EQUALS(event.shapeIdA, playerRightSensor) || B2_ID_EQUALS(event.shapeIdB, playerRightSensor))
                 {
-                    std::cout << "Collision with invalid entity\n";
-                    continue;
+                    ++rightSensorContacts;
                 }
-
-                if (B2_ID_EQUALS(contactData[i].shapeIdA, playerRightSensor) ||
-                    B2_ID_EQUALS(contactData[i].shapeIdB, playerRightSensor))
+                if (categories & collisionCategory::Obstacle)
                 {
-                    rightSensorHit = true;
+                    obstacleHit = true;
                 }
+            }
 
-                const auto tagA = registry.get<ecs::TagComponent>(entityA).tag;
-                const auto tagB = registry.get<ecs::TagComponent>(entityB).tag;
-
-                if (tagA == "obstacle" || tagB == "obstacle" || (rightSensorHit && playerRightSensorHitLastFrame))
+            for (int i = 0; i < contactEvents.endCount; ++i)
+            {
+                // The shapes may be destroyed already, only their ids are compared
+                const b2ContactEndTouchEvent& event = contactEvents.endEvents[i];
+                if ((B2_ID_EQUALS(event.shapeIdA, playerRightSensor) || B2_ID_EQUALS(event.shapeIdB, playerRightSensor))
+                    && rightSensorContacts > 0)
                 {
-                    ecs::EventDispatcher::dispatcher.trigger(ecs::PlayerDeath{player});
-                    rightSensorHit = false;
-                    playerRightSensorHitLastFrame = false;
+                    --rightSensorContacts;
                 }
             }
+
+            const bool rightSensorHit = rightSensorContacts > 0;
+            if (obstacleHit || (rightSensorHit && playerRightSensorHitLastFrame))
+            {
+                ecs::EventDispatcher::dispatcher.trigger(ecs::PlayerDeath{player});
+                playerRightSensorHitLastFrame = false;
+                return;
+            }
             playerRightSensorHitLastFrame = rightSensorHit; //to debounce one frame
         }
     private:
         static inline bool jumpMechanicTriggered = false;
+        static inline b2ShapeId trackedRightSensor = b2_nullShapeId; ///< The right sensor rightSensorContacts counts for.
+        static inline int rightSensorContacts = 0; ///< Shapes touching the player's right sensor.
     };
 } // namespace gl3::engine::physics
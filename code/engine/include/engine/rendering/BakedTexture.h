@@ -0,0 +1,131 @@
+#pragma once
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <span>
+#include "engine/MappedFile.h"
+#include "engine/rendering/Texture.h"
+
+namespace gl3::engine::rendering
+{
+    /**
+     * @brief File header of a baked texture (.ctex).
+     *
+     * Layout: header, mipCount BakedMipLevel entries, then the RGBA8 pixels of every level (rows bottom to top).
+     */
+    struct BakedTextureHeader
+    {
+        static constexpr uint32_t expectedMagic = 0x58545845; ///< "EXTX" in little endian.
+        static constexpr uint32_t currentVersion = 2;
+
+        uint32_t magic = expectedMagic;
+        uint32_t version = currentVersion;
+        uint32_t width = 0; ///< Width of level 0 in pixels.
+        uint32_t height = 0; ///< Height of level 0 in pixels.
+        uint32_t mipCount = 0; ///< Number of levels down to 1x1.
+        uint32_t tilesX = 0; ///< Horizontal tiles of a tileset, 0 if not a tileset.
+        uint32_t tilesY = 0; ///< Vertical tiles of a tileset, 0 if not a tileset.
+        uint32_t sourceChannels = 4; ///< Channels of the source image.
+        uint64_t sourceSize = 0; ///< Size of the source file in bytes, to detect outdated bakes.
+        uint64_t sourceHash = 0; ///< FNV-1a hash of the source file.
+        int64_t sourceWriteTime = 0; ///< Last write time of the source file when it was last hashed.
+    };
+
+    /**
+     * @brief Table entry of one mip level in a baked texture.
+     */
+    struct BakedMipLevel
+    {
+        uint32_t width = 0;
+        uint32_t height = 0;
+        uint64_t offset = 0; ///< Offset of the pixels from the start of the file.
+        uint64_t size = 0; ///< Size of the pixels in bytes.
+    };
+
+    /**
+     * @class BakedTexture
+     * @brief A memory mapped, pre-decoded texture with its full mip chain, produced by the TextureBaker tool.
+     *
+     * Loading one needs no image decoding and no glGenerateMipmap, the levels are uploaded straight from the mapping.
+     */
+    class BakedTexture
+    {
+    public:
+        /// File extension of baked textures.
+        static constexpr auto extension = ".ctex";
+
+        /**
+         * @brief Map and validate a baked texture.
+         * @param path Path to the .ctex file.
+         * @throws std::runtime_error If the file can't be mapped or is not a valid baked texture.
+         */
+        explicit BakedTexture(const std::filesystem::path& path);
+
+        /**
+         * @brief Open the baked version of an image if there is an up to date one.
+         *
+         * A bake is up to date if it has the image's size and write time. If only the write time differs (e.g. the
+         * asset was copied), the image is hashed: the bake is used and its write time refreshed if the content is
+         * unchanged, otherwise the image is decoded as usual.
+         * @param imagePath Path to the source image (e.g. assets/textures/Spike.png).
+         * @return The baked texture, nullptr if there is none or it was baked from a different file.
+         */
+        static std::unique_ptr<BakedTexture> openFor(const std::filesystem::path& imagePath);
+
+        /**
+         * @brief Where the baked version of an image lives: assets/baked/<folder>/<name>.ctex
+         * @param imagePath Path to the source image inside an asset folder.
+         * @return Path to the baked texture.
+         */
+        static std::filesystem::path bakedPathFor(const std::filesystem::path& imagePath);
+
+        /**
+         * @brief Bake an image into a file, generating the full mip chain.
+         * @param image The decoded level 0.
+         * @param tilesX Horizontal tiles if the image is a tileset, 0 otherwise.
+         * @param tilesY Vertical tiles if the image is a tileset, 0 otherwise.
+         * @param sourceSize Size of the source file in bytes.
+         * @param sourceHash FNV-1a hash of the source file, @see FileFingerprint::hash
+         * @param sourceWriteTime Last write time of the source file, @see FileFingerprint::getWriteTime
+         * @param path Destination path.
+         * @throws std::runtime_error If the file can't be written.
+         */
+        static void write(const ImageData& image, int tilesX, int tilesY, uint64_t sourceSize, uint64_t sourceHash,
+                          int64_t sourceWriteTime, const std::filesystem::path& path);
+
+        /**
+         * @brief Read the header of a baked texture without mapping the pixels.
+         * @param path Path to the .ctex file.
+         * @param header Receives the header.
+         * @return False if the file doesn't exist or has no valid header.
+         */
+        static bool readHeader(const std::filesystem::path& path, BakedTextureHeader& header);
+
+        /**
+         * @brief Downsample an RGBA8 image by two with a box filter (odd edges are clamped).
+         * @param image The source level.
+         * @return The next smaller level.
+         */
+        [[nodiscard]] static ImageData downsample(const ImageData& image);
+
+        /// @return The file header.
+        [[nodiscard]] const BakedTextureHeader& getHeader() const { return *header; }
+
+        /// @return The table entry of a mip level.
+        [[nodiscard]] const BakedMipLevel& getLevel(const uint32_t level) const { return levels[level]; }
+
+        /// @return Pointer to the RGBA8 pixels of a mip level inside the mapping.
+        [[nodiscard]] const std::byte* getPixels(const uint32_t level) const
+        {
+            return file.data() + levels[level].offset;
+        }
+
+        /// @return A copy of level 0, e.g. for packing it into an atlas.
+        [[nodiscard]] ImageData toImage() const;
+
+    private:
+        MappedFile file;
+        const BakedTextureHeader* header = nullptr;
+        const BakedMipLevel* levels = nullptr;
+    };
+}
@@ -0,0 +1,47 @@
+#pragma once
+#include "engine/rendering/Shader.h"
+
+namespace gl3::engine::rendering
+{
+    /**
+     * @brief Uniforms the RenderingSystem sets when drawing an entity with a custom shader.
+     *
+     * Resolved once when the entity's program is loaded, so drawing never looks a uniform up by name. Custom shaders
+     * only use some of them, the handles of the others stay invalid and setting them is a no-op.
+     */
+    struct CustomShaderUniforms
+    {
+        CustomShaderUniforms() = default;
+
+        /**
+         * @brief Resolve the uniforms of a program.
+         * @param shader The linked program.
+         */
+        explicit CustomShaderUniforms(const Shader& shader) :
+            model(shader.findUniform<glm::mat4>("model")),
+            mvp(shader.findUniform<glm::mat4>("mvp")),
+            color(shader.findUniform<glm::vec4>("color")),
+            atlasRect(shader.findUniform<glm::vec4>("atlasRect")),
+            uvRect(shader.findUniform<glm::vec4>("uvRect")),
+            topColor(shader.findUniform<glm::vec4>("topColor")),
+            bottomColor(shader.findUniform<glm::vec4>("bottomColor")),
+            useTexture(shader.findUniform<int>("useTexture")),
+            texture(shader.findUniform<int>("texture1")),
+            uvOffset(shader.findUniform<glm::vec2>("uvOffset")),
+            repeatTexture(shader.findUniform<int>("repeatTexture"))
+        {
+        }
+
+        UniformHandle<glm::mat4> model; ///< Model matrix, engine shaders read the camera from the FrameCamera block.
+        UniformHandle<glm::mat4> mvp; ///< Full mvp matrix, for custom shaders that don't use the FrameCamera block.
+        UniformHandle<glm::vec4> color;
+        UniformHandle<glm::vec4> atlasRect; ///< Invalid if the shader expects uvs already mapped into the atlas.
+        UniformHandle<glm::vec4> uvRect;
+        UniformHandle<glm::vec4> topColor; ///< Gradient shaders only.
+        UniformHandle<glm::vec4> bottomColor; ///< Gradient shaders only.
+        UniformHandle<int> useTexture;
+        UniformHandle<int> texture; ///< Sampler, bound to texture unit 0.
+        UniformHandle<glm::vec2> uvOffset;
+        UniformHandle<int> repeatTexture;
+    };
+}
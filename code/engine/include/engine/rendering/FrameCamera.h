@@ -0,0 +1,44 @@
+#pragma once
+#include <glm/glm.hpp>
+#include "glad/glad.h"
+#include "engine/Constants.h"
+
+namespace gl3::engine::rendering
+{
+    /**
+     * @brief Uniform buffer binding point of the FrameCamera block in all engine shaders.
+     */
+    constexpr GLuint frameCameraBindingPoint = 0;
+
+    /**
+     * @brief Snapshot of the camera for the current frame.
+     *
+     * Computed by the Context once per frame and whenever the camera or window changes, so per-entity work only needs
+     * the model transform and culling can read the cached bounds.
+     */
+    struct FrameCamera
+    {
+        glm::mat4 view = glm::mat4(1.f); ///< View matrix in pixel space.
+        glm::mat4 projection = glm::mat4(1.f); ///< Orthographic projection in pixel space.
+        glm::mat4 viewProjection = glm::mat4(1.f); ///< projection * view.
+        glm::mat4 inverseViewProjection = glm::mat4(1.f); ///< For converting screen to world positions.
+        glm::vec4 worldBounds = {0.f, 0.f, 0.f, 0.f}; ///< Visible world window in meters: left, right, top, bottom.
+        glm::vec2 windowSize = {0.f, 0.f}; ///< Window size in screen coordinates.
+        float pixelsPerMeter = ::pixelsPerMeter; ///< World to pixel scale.
+    };
+
+    /**
+     * @brief GPU side of the FrameCamera, matches the std140 block
+     * @code
+     * layout (std140, binding = 0) uniform FrameCamera { mat4 viewProjection; vec4 worldBounds; vec4 viewport; };
+     * @endcode
+     */
+    struct FrameCameraBlock
+    {
+        glm::mat4 viewProjection;
+        glm::vec4 worldBounds; ///< left, right, top, bottom in meters.
+        glm::vec4 viewport; ///< xy: window size, z: pixels per meter, w: unused.
+    };
+
+    static_assert(sizeof(FrameCameraBlock) == 96, "FrameCameraBlock must match the std140 layout");
+}
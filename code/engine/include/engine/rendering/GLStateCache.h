@@ -0,0 +1,122 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "glad/glad.h"
+
+namespace gl3::engine::rendering
+{
+    /**
+     * @brief Prebuilt sampler objects, selecting the wrap mode of a texture without mutating the texture itself.
+     */
+    enum class SamplerType : uint8_t
+    {
+        None = 0, ///< No sampler, the texture's own parameters are used.
+        Repeat = 1, ///< Repeat on s and t.
+        ClampToBorder = 2 ///< Clamp to the (transparent) border on s and t.
+    };
+
+    /**
+     * @class GLStateCache
+     * @brief Static tracker of the bound program, VAO, textures and samplers, turning redundant binds into no-ops.
+     *
+     * All engine rendering code binds through this class. Call invalidate() whenever code outside the engine
+     * (e.g. ImGui) may have changed the GL state, and the forget* functions when a tracked object is deleted,
+     * so a recycled ID is not mistaken for still being bound.
+     */
+    class GLStateCache
+    {
+    public:
+        /**
+         * @brief Counters of issued and skipped state changes.
+         */
+        struct Counters
+        {
+            size_t issued = 0; ///< State changes forwarded to OpenGL.
+            size_t skipped = 0; ///< Redundant state changes that were skipped.
+        };
+
+        /// Number of texture units tracked by the cache.
+        static constexpr GLuint maxTextureUnits = 8;
+
+        /**
+         * @brief Bind a shader program if it is not bound yet.
+         * @param program OpenGL program ID.
+         */
+        static void useProgram(GLuint program);
+
+        /**
+         * @brief Bind a vertex array if it is not bound yet.
+         * @param vao OpenGL vertex array ID.
+         */
+        static void bindVertexArray(GLuint vao);
+
+        /**
+         * @brief Bind a 2D texture to a texture unit if it is not bound there yet.
+         * @param unit Texture unit (0 to maxTextureUnits - 1).
+         * @param texture OpenGL texture ID.
+         */
+        static void bindTexture(GLuint unit, GLuint texture);
+
+        /**
+         * @brief Bind one of the prebuilt samplers to a texture unit if it is not bound there yet.
+         * @param unit Texture unit (0 to maxTextureUnits - 1).
+         * @param sampler The sampler to bind, SamplerType::None unbinds the sampler.
+         */
+        static void bindSampler(GLuint unit, SamplerType sampler);
+
+        /**
+         * @brief Forget all tracked state, the next bind of everything is issued again.
+         * Call this after code outside the engine (e.g. ImGui) rendered.
+         */
+        static void invalidate();
+
+        /**
+         * @brief Stop tracking a deleted program.
+         * @param program The deleted OpenGL program ID.
+         */
+        static void forgetProgram(GLuint program);
+
+        /**
+         * @brief Stop tracking a deleted vertex array.
+         * @param vao The deleted OpenGL vertex array ID.
+         */
+        static void forgetVertexArray(GLuint vao);
+
+        /**
+         * @brief Stop tracking a deleted texture.
+         * @param texture The deleted OpenGL texture ID.
+         */
+        static void forgetTexture(GLuint texture);
+
+        /**
+         * @brief Delete the prebuilt sampler objects, e.g. before the GL context is destroyed.
+         */
+        static void releaseSamplers();
+
+        /// @return Issued and skipped state changes since the last resetCounters().
+        [[nodiscard]] static const Counters& getCounters() { return counters; }
+
+        /**
+         * @brief Reset the issued and skipped counters, e.g. at the start of a frame.
+         */
+        static void resetCounters() { counters = {}; }
+
+    private:
+        /**
+         * @brief Create the prebuilt sampler objects on first use.
+         */
+        static void createSamplers();
+
+        static constexpr GLuint unknown = ~0u; ///< Marks state that has to be re-issued.
+
+        static GLuint current_program;
+        static GLuint current_vao;
+        static std::array<GLuint, maxTextureUnits> current_textures;
+        static std::array<SamplerType, maxTextureUnits> current_samplers;
+        static std::array<bool, maxTextureUnits> sampler_known; ///< False if a unit's sampler has to be re-issued.
+        static GLuint active_unit;
+        static std::array<GLuint, 3> samplers; ///< Sampler objects by SamplerType, index 0 is unused.
+        static Counters counters;
+    };
+}
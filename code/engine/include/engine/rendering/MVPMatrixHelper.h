@@ -22,35 +22,50 @@ namespace gl3::engine::rendering
     public:
         /**
          * @brief Computes the view matrix based on the camera position.
-         * @param context The rendering context providing camera information.
+         * @param cameraPosition The camera position in pixels.
          * @return The view matrix translating the scene by the inverse camera position.
          */
-        static glm::mat4 calculateViewMatrix(const context::Context& context)
+        static glm::mat4 calculateViewMatrix(const glm::vec3& cameraPosition)
         {
-            return translate(glm::mat4(1.0f), -context.getCameraPos());
+            return translate(glm::mat4(1.0f), -cameraPosition);
         }
 
         /**
-         * @brief Computes the orthographic projection matrix for the current window size.
-         * @param context The rendering context providing camera and window information.
-         * @return The orthographic projection matrix in world space.
+         * @brief Get the view matrix of the current frame.
+         * @param context The rendering context providing the cached FrameCamera.
+         * @return The view matrix translating the scene by the inverse camera position.
+         */
+        static const glm::mat4& calculateViewMatrix(const context::Context& context)
+        {
+            return context.getFrameCamera().view;
+        }
+
+        /**
+         * @brief Computes the orthographic projection matrix for a window size.
+         *
+         * The projection is centered on the origin, the camera offset is applied by the view matrix only.
+         *
+         * @param windowSize The window size in screen coordinates.
+         * @return The orthographic projection matrix in view space.
          */
-        static glm::mat4 calculateProjectionMatrix(const context::Context& context)
+        static glm::mat4 calculateProjectionMatrix(const glm::vec2& windowSize)
         {
-            int width;
-            int height;
-            glfwGetWindowSize(context.getWindow(), &width, &height);
-            const auto fWidth = static_cast<float>(width);
-            const auto fHeight = static_cast<float>(height);
-            const glm::vec2 camPos = context.getCameraPos();
-
-            return glm::ortho(camPos.x - (fWidth * 0.5f), camPos.x + (fWidth * 0.5f),
-                              camPos.y - fHeight * 0.5f,
-                              camPos.y + fHeight * 0.5f,
+            return glm::ortho(-windowSize.x * 0.5f, windowSize.x * 0.5f,
+                              -windowSize.y * 0.5f, windowSize.y * 0.5f,
                               0.1f,
                               10.f);
         }
 
+        /**
+         * @brief Get the orthographic projection matrix of the current frame.
+         * @param context The rendering context providing the cached FrameCamera.
+         * @return The orthographic projection matrix in world space.
+         */
+        static const glm::mat4& calculateProjectionMatrix(const context::Context& context)
+        {
+            return context.getFrameCamera().projection;
+        }
+
         /**
          * @brief Builds a model matrix for an object given its position, rotation, and scale.
          *
@@ -75,7 +90,7 @@ namespace gl3::engine::rendering
         /**
          * @brief Calculate the full MVP matrix for an entity.
          *
-         * Combines Model, View, and Projection transforms.
+         * Combines the model transform with the cached view-projection of the current frame.
          *
          * @param position World position in meters.
          * @param zRotationInDegrees Rotation around Z axis in degrees.
@@ -86,11 +101,8 @@ namespace gl3::engine::rendering
         static glm::mat4 calculateMvpMatrix(const glm::vec3& position, const float& zRotationInDegrees,
                                             const glm::vec3& scale, const context::Context& context)
         {
-            const auto model = calculateModelMatrix(position, zRotationInDegrees, scale);
-            const glm::mat4 view = calculateViewMatrix(context);
-            const glm::mat4 projection = calculateProjectionMatrix(context);
-
-            return projection * view * model;
+            return context.getFrameCamera().viewProjection *
+                calculateModelMatrix(position, zRotationInDegrees, scale);
         }
 
         /**
@@ -103,19 +115,13 @@ namespace gl3::engine::rendering
          */
         static glm::vec2 screenToWorld(const context::Context& context, const float screenPosX, const float screenPosY)
         {
-            int width, height;
-            glfwGetWindowSize(context.getWindow(), &width, &height);
+            const auto& camera = context.getFrameCamera();
 
-            const float ndcX = (screenPosX / static_cast<float>(width)) * 2.0f - 1.0f;
-            const float ndcY = 1.0f - (screenPosY / static_cast<float>(height)) * 2.0f;
+            const float ndcX = (screenPosX / camera.windowSize.x) * 2.0f - 1.0f;
+            const float ndcY = 1.0f - (screenPosY / camera.windowSize.y) * 2.0f;
 
             const glm::vec4 clipPos = glm::vec4(ndcX, ndcY, 0.f, 1.f);
-
-            const glm::mat4 projection = calculateProjectionMatrix(context);
-            const glm::mat4 view = calculateViewMatrix(context);
-
-            const glm::mat4 inv = glm::inverse(projection * view);
-            const glm::vec4 world = inv * clipPos;
+            const glm::vec4 world = camera.inverseViewProjection * clipPos;
 
             return {world.x / pixelsPerMeter, world.y / pixelsPerMeter};
         }
@@ -132,10 +138,7 @@ namespace gl3::engine::rendering
         {
             const glm::vec4 worldPos(x * pixelsPerMeter, y * pixelsPerMeter, 0.f, 1.f);
 
-            const glm::mat4 projection = calculateProjectionMatrix(context);
-            const glm::mat4 view = calculateViewMatrix(context);
-
-            const glm::vec4 clip = projection * view * worldPos;
+            const glm::vec4 clip = context.getFrameCamera().viewProjection * worldPos;
 
             const ImVec2 screenSize = ImGui::GetIO().DisplaySize;
             const float ndcX = clip.x / clip.w;
@@ -62,6 +62,15 @@ namespace gl3::engine::rendering
          */
         void release();
 
+        /// @return The OpenGL Vertex Buffer Object, e.g. to share it with another VAO.
+        [[nodiscard]] unsigned int getVBO() const { return VBO; }
+
+        /// @return The OpenGL Element Buffer Object.
+        [[nodiscard]] unsigned int getEBO() const { return EBO; }
+
+        /// @return Number of indices used for drawing.
+        [[nodiscard]] unsigned int getIndexCount() const { return number_of_indices; }
+
     private:
         unsigned int VAO = 0;  ///< OpenGL Vertex Array Object.
         unsigned int VBO = 0;  ///< OpenGL Vertex Buffer Object.
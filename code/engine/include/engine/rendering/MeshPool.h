@@ -0,0 +1,44 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include "engine/rendering/Mesh.h"
+
+namespace gl3::engine::rendering
+{
+    /**
+     * @brief Unit geometry a sprite is drawn with.
+     */
+    enum class SpriteShape : uint8_t
+    {
+        Quad = 0, ///< Unit quad centered on the origin.
+        Triangle = 1 ///< Unit triangle with its tip at the top center.
+    };
+
+    /**
+     * @class MeshPool
+     * @brief Static class holding the shared unit meshes all sprites are drawn with.
+     *
+     * Every sprite is a unit quad or unit triangle scaled by its model matrix, only the uvs differ. The unit meshes
+     * have uvs from 0 to 1, shaders map them onto the sprite's uv rect, so creating entities allocates no GL buffers.
+     */
+    class MeshPool
+    {
+    public:
+        /**
+         * @brief Get the shared unit mesh of a shape, created on first use.
+         * @param shape The shape of the mesh.
+         * @return The unit mesh.
+         * @note Needs a current OpenGL context.
+         */
+        static const Mesh& get(SpriteShape shape);
+
+        /**
+         * @brief Release the unit meshes, e.g. before the GL context is destroyed.
+         */
+        static void clear();
+
+    private:
+        static std::unique_ptr<Mesh> unit_quad; ///< Quad from (-0.5, -0.5) to (0.5, 0.5).
+        static std::unique_ptr<Mesh> unit_triangle; ///< Triangle with its tip at (0, 0.5).
+    };
+}
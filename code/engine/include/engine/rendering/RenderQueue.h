@@ -0,0 +1,180 @@
+#pragma once
+#include <cstdint>
+#include <map>
+#include <unordered_map>
+#include <vector>
+#include <entt/entt.hpp>
+#include "engine/ecs/EntityFactory.h"
+#include "engine/rendering/SpatialGrid.h"
+
+namespace gl3::engine::rendering
+{
+    /**
+     * @brief Order of entities inside one z-layer: grouped by render state, so consecutive entities rarely need a
+     * shader, texture or mesh change.
+     */
+    struct RenderSortKey
+    {
+        bool isCustomShader = false; ///< Batched sprites first, then entities with their own shader.
+        std::uintptr_t shader = 0; ///< Shared program, one per ShaderCache entry.
+        GLuint texture = 0; ///< Texture (atlas page) ID, 0 if untextured.
+        SpriteShape shape = SpriteShape::Quad;
+        std::uint32_t entity = 0; ///< Keeps the order deterministic between equal states.
+
+        auto operator<=>(const RenderSortKey&) const = default;
+    };
+
+    /**
+     * @class RenderQueue
+     * @brief Keeps render-able entities ordered back to front without sorting the whole registry.
+     *
+     * Entities are bucketed by their ZLayerComponent through EnTT construct/update/destroy signals. Adding or removing
+     * an entity only marks its own bucket dirty, and update() sorts just the dirty buckets by their RenderSortKey.
+     * All entities are also kept in a SpatialGrid, so collectVisible() only visits entities near the camera window.
+     * @note Change a z-layer with registry.patch/replace, so the queue can move the entity to its new bucket. The same
+     * goes for moving an entity: patch its TransformComponent afterwards, so its grid cells are updated.
+     */
+    class RenderQueue
+    {
+    public:
+        /**
+         * @brief One z-layer.
+         */
+        struct Bucket
+        {
+            std::vector<entt::entity> entities; ///< Entities of the layer, in RenderSortKey order after update().
+            bool dirty = false; ///< Entities were added, removed or changed since the last sort.
+        };
+
+        /**
+         * @brief An entity found by collectVisible().
+         */
+        struct VisibleEntity
+        {
+            float layer; ///< Z-layer of the entity.
+            size_t index; ///< Position inside the sorted bucket.
+            entt::entity entity;
+
+            auto operator<=>(const VisibleEntity& other) const
+            {
+                if (const auto order = layer <=> other.layer; order != 0) return order;
+                return index <=> other.index;
+            }
+
+            bool operator==(const VisibleEntity& other) const = default;
+        };
+
+        /**
+         * @brief Bucket all existing entities and connect to the registry signals.
+         * @param registry The registry to track.
+         */
+        explicit RenderQueue(entt::registry& registry);
+
+        /**
+         * @brief Disconnect from the registry signals.
+         */
+        ~RenderQueue();
+
+        RenderQueue(const RenderQueue&) = delete;
+        RenderQueue& operator=(const RenderQueue&) = delete;
+
+        /**
+         * @brief Sort all dirty buckets. Call once per frame before iterating the buckets.
+         */
+        void update();
+
+        /**
+         * @brief Mark the bucket of an entity for sorting, e.g. after changing its texture or shader directly.
+         * @param entity The entity.
+         */
+        void markDirty(entt::entity entity);
+
+        /**
+         * @brief Collect the entities in the grid cells overlapping an x range, in draw order.
+         * The cells are coarse, the exact bounds of the entities still need to be tested.
+         * @param minX Left edge of the range in world units.
+         * @param maxX Right edge of the range in world units.
+         * @param visible Cleared and filled with the entities, back to front and sorted like their buckets.
+         * @note Call update() first, so the buckets are sorted.
+         */
+        void collectVisible(float minX, float maxX, std::vector<VisibleEntity>& visible) const;
+
+        /// @return All z-layers back to front.
+        [[nodiscard]] const std::map<float, Bucket>& getBuckets() const { return buckets; }
+
+        /// @return Number of buckets sorted in the last update().
+        [[nodiscard]] size_t getSortedBucketCount() const { return sorted_buckets; }
+
+    private:
+        /**
+         * @brief Where an entity is stored.
+         */
+        struct Slot
+        {
+            float layer = 0.f;
+            size_t index = 0;
+        };
+
+        /**
+         * @brief Signal handler: a ZLayerComponent was added.
+         */
+        void onLayerConstruct(entt::registry& registry, entt::entity entity);
+
+        /**
+         * @brief Signal handler: a ZLayerComponent was patched or replaced.
+         */
+        void onLayerUpdate(entt::registry& registry, entt::entity entity);
+
+        /**
+         * @brief Signal handler: a ZLayerComponent is about to be removed.
+         */
+        void onLayerDestroy(entt::registry& registry, entt::entity entity);
+
+        /**
+         * @brief Signal handler: a RenderComponent was added or changed, its sort key may differ now.
+         */
+        void onRenderChange(entt::registry& registry, entt::entity entity);
+
+        /**
+         * @brief Signal handler: a TransformComponent was added or patched, update the grid cells of its entity.
+         */
+        void onTransformChange(entt::registry& registry, entt::entity entity);
+
+        /**
+         * @brief Signal handler: a TransformComponent is about to be removed.
+         */
+        void onTransformDestroy(entt::registry& registry, entt::entity entity);
+
+        /**
+         * @brief Store an entity in the grid cells of its rotated x extent.
+         * @param entity The entity, has to have a TransformComponent.
+         */
+        void placeInGrid(entt::entity entity);
+
+        /**
+         * @brief Append an entity to the bucket of a layer.
+         * @param entity The entity.
+         * @param layer The z-layer.
+         */
+        void insert(entt::entity entity, float layer);
+
+        /**
+         * @brief Remove an entity from its bucket by swapping it with the last one.
+         * @param entity The entity.
+         */
+        void remove(entt::entity entity);
+
+        /**
+         * @brief Build the sort key of an entity.
+         * @param entity The entity.
+         * @return The key.
+         */
+        [[nodiscard]] RenderSortKey makeKey(entt::entity entity) const;
+
+        entt::registry& registry;
+        std::map<float, Bucket> buckets;
+        std::unordered_map<entt::entity, Slot> slots;
+        SpatialGrid grid;
+        size_t sorted_buckets = 0;
+    };
+}
@@ -1,9 +1,15 @@
 #pragma once
+#include <memory>
+#include <vector>
 #include <entt/entt.hpp>
 #include "engine/ecs/EntityFactory.h"
 #include "engine/ecs/System.h"
 #include "engine/levelloading/LevelManager.h"
+#include "engine/physics/PhysicsSystem.h"
 #include "engine/rendering/MVPMatrixHelper.h"
+#include "engine/rendering/GLStateCache.h"
+#include "engine/rendering/RenderQueue.h"
+#include "engine/rendering/SpriteBatch.h"
 
 namespace gl3::engine::rendering
 {
@@ -11,144 +17,208 @@ namespace gl3::engine::rendering
      * @class RenderingSystem
      * @brief ECS system responsible for rendering all entities with a RenderComponent.
      *
-     * Uses an MVP matrix to transform objects and handles texture binding,
-     * shader uniform setup, parallax scrolling, and gradient skies.
+     * Batches entities with the default shaders into instanced draw calls and draws entities with custom shaders
+     * (e.g. gradient skies) one by one. Handles texture binding, shader uniform setup and parallax scrolling.
      */
     class RenderingSystem final : public ecs::System
     {
     public:
-        std::vector<entt::entity> renderQueue;
         /**
          * @brief Construct a new RenderingSystem.
          * @param game Reference to the main game instance.
          */
-        explicit RenderingSystem(Game& game) : System(game)
+        explicit RenderingSystem(Game& game) : System(game) {}
+
+        /**
+         * @brief Render all visible entities with active RenderComponents.
+         *
+         * Entities come back to front from the RenderQueue, grouped by shader and texture inside each z-layer.
+         * Entities using the default shaders are collected into the SpriteBatch and drawn with one instanced draw call
+         * per texture, wrap mode and shape. The batch is flushed whenever the z-layer changes, so back to front order
+         * between layers is kept. Entities with custom shaders (e.g. gradients) are drawn one by one after flushing
+         * everything submitted before them. Applies parallax UV offset if enabled. Only entities the RenderQueue's
+         * spatial grid finds near the visible window are looked at, so the cost does not grow with the level length.
+         */
+        void draw()
         {
-            ecs::EventDispatcher::dispatcher.sink<ecs::RenderComponentContainerChange>().connect<&
-                RenderingSystem::onRenderContainerChange>(this);
+            if (!is_active) { return; }
+
+            if (!sprite_batch) sprite_batch = std::make_unique<SpriteBatch>();
+
+            auto& registry = game.getRegistry();
+            const auto& context = game.getContext();
+            // The registry is constructed after the systems, so the queue can only connect to it now
+            if (!render_queue) render_queue = std::make_unique<RenderQueue>(registry);
+            render_queue->update();
+
+            // ImGui and other code may have changed the GL state since the last frame
+            GLStateCache::invalidate();
+            GLStateCache::resetCounters();
+
+            sprite_batch->begin();
+
+            // Only entities in grid cells overlapping the camera window, instead of the whole level
+            const auto& worldBounds = context.getFrameCamera().worldBounds;
+            render_queue->collectVisible(worldBounds.x, worldBounds.y, visible_entities);
+            // Physics runs at a fixed rate, blend between its last two steps for smooth motion at any frame rate
+            const float alpha = game.getPhysicsSystem()->getInterpolationAlpha();
+
+            bool hasLayer = false;
+            float currentLayer = 0.f;
+            for (const auto& [zLayer, index, entity] : visible_entities)
+            {
+                auto* renderComp = registry.try_get<ecs::RenderComponent>(entity);
+                if (!renderComp || !renderComp->isActive) continue;
+
+                auto* transform = registry.try_get<ecs::TransformComponent>(entity);
+                // Grid cells are coarse, test the exact bounds too
+                if (!transform || !context.isInVisibleWindow(transform->position, transform->scale)) continue;
+
+                // Entities of one layer may be reordered by the batch, layers themselves stay back to front
+                if (!hasLayer || zLayer != currentLayer)
+                {
+                    sprite_batch->flush();
+                    currentLayer = zLayer;
+                    hasLayer = true;
+                }
+
+                updateParallax(*transform, *renderComp);
+
+                const glm::vec3 position = transform->getInterpolatedPosition(alpha);
+                if (renderComp->isBatched)
+                {
+                    submitSprite(*transform, position, *renderComp);
+                }
+                else if (const auto* customShader = registry.try_get<ecs::CustomShaderComponent>(entity))
+                {
+                    sprite_batch->flush();
+                    drawUnbatched(*transform, position, *renderComp, *customShader);
+                }
+            }
+            sprite_batch->flush();
+
+            // Let ImGui sample textures with their own parameters again
+            GLStateCache::bindSampler(0, SamplerType::None);
         };
 
         /**
-         * @brief Disconnect from events.
+         * @return The SpriteBatch used for drawing, nullptr before the first frame was drawn.
          */
-        ~RenderingSystem() override
-        {
-            ecs::EventDispatcher::dispatcher.sink<ecs::RenderComponentContainerChange>().disconnect<&
-                RenderingSystem::onRenderContainerChange>(this);
-        }
+        [[nodiscard]] const SpriteBatch* getSpriteBatch() const { return sprite_batch.get(); }
 
         /**
-         * @brief Orders render-able entities back to front via z-position
+         * @return The RenderQueue ordering the entities, nullptr before the first frame was drawn.
          */
-        void sortBackToFront() const
+        [[nodiscard]] RenderQueue* getRenderQueue() const { return render_queue.get(); }
+
+    private:
+        /**
+         * @brief Advance the parallax UV offset of a textured entity if enabled and the game is running.
+         * @param transform The entity's transform.
+         * @param renderComp The entity's render component.
+         */
+        void updateParallax(const ecs::TransformComponent& transform, ecs::RenderComponent& renderComp) const
         {
-            game.getRegistry().sort<ecs::ZLayerComponent>(
-                [](const ecs::ZLayerComponent& lhs, const ecs::ZLayerComponent& rhs)
-                {
-                    return lhs.zLayer < rhs.zLayer;
-                });
+            if (!renderComp.texture || transform.parallaxFactor == 0 || game.isPaused()) return;
+
+            const float pixelsPerSecond = levelLoading::LevelManager::getCurrentLevel()->currentLevelSpeed;
+            const float uvPerSecond = pixelsPerSecond * renderComp.repeatAmount / transform.scale.x;
+
+            renderComp.uvOffset.x += transform.parallaxFactor * uvPerSecond * game.getDeltaTime();
+            renderComp.uvOffset.x = std::fmod(renderComp.uvOffset.x, 1.0f);
         }
 
         /**
-        * @brief Signal to order render-able entities back to front via z-position
-        * Trigger the corresponding event, after initializing your entities in the registry or whenever you add an entity.
-        * @note Also see @ref ecs::RenderComponentContainerChange for dispatching an event for it.
-        */
-        void onRenderContainerChange(ecs::RenderComponentContainerChange& event)
+         * @brief Queue an entity with default shaders in the SpriteBatch.
+         * @param transform The entity's transform.
+         * @param position The entity's interpolated position.
+         * @param renderComp The entity's render component.
+         */
+        void submitSprite(const ecs::TransformComponent& transform, const glm::vec3& position,
+                          const ecs::RenderComponent& renderComp) const
         {
-            sortRenderEntities = true;
+            SpriteBatchKey key;
+            key.texture = renderComp.texture ? renderComp.texture->getID() : 0;
+            key.shape = renderComp.shape;
+
+            SpriteInstance instance;
+            instance.model = MVPMatrixHelper::calculateModelMatrix(position, transform.zRotation, transform.scale);
+            instance.uvRect = renderComp.getUvRect();
+            instance.color = renderComp.color;
+            instance.uvParams = {
+                renderComp.uvOffset.x, renderComp.uvOffset.y, renderComp.texture ? 1.f : 0.f,
+                renderComp.repeatX ? 1.f : 0.f
+            };
+            instance.atlasRect = renderComp.atlasRect;
+
+            sprite_batch->submit(key, instance);
         }
 
         /**
-         * @brief Render all visible entities with active RenderComponents.
-         *
-         * Draws each entity using its mesh, texture, shader, and transform.
-         * Applies parallax UV offset if enabled. Skips rendering if the entity
-         * is outside the visible window.
+         * @brief Draw an entity with a custom shader on its own.
+         * @param transform The entity's transform.
+         * @param position The entity's interpolated position.
+         * @param renderComp The entity's render component.
+         * @param customShader The entity's shader and gradient colors.
          */
-        void draw() const
+        void drawUnbatched(const ecs::TransformComponent& transform, const glm::vec3& position,
+                           const ecs::RenderComponent& renderComp,
+                           const ecs::CustomShaderComponent& customShader) const
         {
-            if (!is_active) { return; }
+            const auto model = MVPMatrixHelper::calculateModelMatrix(position, transform.zRotation, transform.scale);
+            const auto& shader = *customShader.shader;
+            const auto& uniforms = customShader.uniforms;
+            shader.use();
+            // Engine shaders read the camera from the FrameCamera uniform block and only need the model matrix
+            shader.set(uniforms.model, model);
+            // Custom shaders may still expect a full mvp matrix
+            if (uniforms.mvp.isValid())
+            {
+                shader.set(uniforms.mvp, game.getContext().getFrameCamera().viewProjection * model);
+            }
+            // Custom shaders only use some of these uniforms, setting a missing one is a no-op
+            shader.set(uniforms.color, renderComp.color);
+            // Shaders without an atlasRect uniform get the uv rect already mapped into the texture (no wrapping)
+            glm::vec4 uvRect = renderComp.getUvRect();
+            if (!uniforms.atlasRect.isValid())
+            {
+                const glm::vec2 size = {
+                    renderComp.atlasRect.z - renderComp.atlasRect.x, renderComp.atlasRect.w - renderComp.atlasRect.y
+                };
+                uvRect = {
+                    renderComp.atlasRect.x + uvRect.x * size.x, renderComp.atlasRect.y + uvRect.y * size.y,
+                    renderComp.atlasRect.x + uvRect.z * size.x, renderComp.atlasRect.y + uvRect.w * size.y
+                };
+            }
+            shader.set(uniforms.uvRect, uvRect);
 
-            if (sortRenderEntities)sortBackToFront();
+            // If gradient top and bottom are not the same color -> Handle color gradient
+            if (!glm::all(glm::epsilonEqual(customShader.gradientTopColor, customShader.gradientBottomColor, 0.001f)))
+            {
+                shader.set(uniforms.topColor, customShader.gradientTopColor);
+                shader.set(uniforms.bottomColor, customShader.gradientBottomColor);
+            }
 
-            auto& registry = game.getRegistry();
-            const auto& context = game.getContext();
+            // Programs are shared, so reset the texture flag for untextured entities too
+            shader.set(uniforms.useTexture, renderComp.texture ? 1 : 0);
 
-            //views use the order in which the entities are in the container with the lowest number of entities (or else first) (here ZLayerComp)
-            const auto& entities = registry.view<
-                ecs::ZLayerComponent,
-                //only works if ZLayerComponent store is smallest of these three -> entities view will use its order (back to front)
-                ecs::TransformComponent, ecs::TagComponent>();
-            for (const auto& entity : entities)
+            // Bind and setup texture if available
+            if (renderComp.texture)
             {
-                auto& transform = entities.get<ecs::TransformComponent>(entity);
-                if (!game.getRegistry().any_of<ecs::RenderComponent>(entity)) continue;
-
-                auto& renderComp = game.getRegistry().get<ecs::RenderComponent>(entity);
-                auto tag = entities.get<ecs::TagComponent>(entity).tag;
-                // Render object if in view
-                if (context.isInVisibleWindow(transform.position, transform.scale) && renderComp.isActive)
-                {
-                    const auto mvpMatrix = MVPMatrixHelper::calculateMvpMatrix(
-                        transform.position, transform.zRotation, transform.scale,
-                        context);
-                    renderComp.shader.use();
-                    renderComp.shader.setMat4("mvp", mvpMatrix);
-                    renderComp.shader.setVector4("color", renderComp.color);
-
-                    // If gradient top and bottom are not the same color -> Handle color gradient
-                    if (!glm::all(glm::epsilonEqual(renderComp.gradientTopColor, renderComp.gradientBottomColor, 0.001f)))
-                    {
-                        renderComp.shader.setVector4("topColor", renderComp.gradientTopColor);
-                        renderComp.shader.setVector4("bottomColor", renderComp.gradientBottomColor);
-                    }
-
-                    // Bind and setup texture if available
-                    if (renderComp.texture)
-                    {
-                        renderComp.shader.setInt("useTexture", 1);
-                        renderComp.texture->bind(0);
-                        if(!renderComp.repeatX)
-                        {
-                            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_BORDER);
-                            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_BORDER);
-                        } else
-                        {
-                            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-                            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-                        }
-                        renderComp.shader.setInt("texture1", 0);
-
-                        // Handle parallax UV offset if enabled and game is running
-                        if (transform.parallaxFactor != 0 && !game.isPaused())
-                        {
-                            const float pixelsPerSecond = levelLoading::LevelManager::getCurrentLevel()->
-                                currentLevelSpeed;
-
-                            const float uvPerSecond = pixelsPerSecond * renderComp.repeatAmount / transform.scale.x;
-
-                            renderComp.uvOffset.x += transform.parallaxFactor * uvPerSecond * game.getDeltaTime();
-                            renderComp.uvOffset.x = std::fmod(renderComp.uvOffset.x, 1.0f);
-
-                            renderComp.shader.setVec2("uvOffset", renderComp.uvOffset);
-                        }
-                    }
-
-                    renderComp.mesh.draw();
-
-
-                    //Quick fix to stop ImGui Texture from vanishing
-                    if (renderComp.texture) {
-                        renderComp.texture->bind(0);
-                        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-                        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-                    }
-                }
+                renderComp.texture->bind(0);
+                // Engine shaders wrap inside the atlas rect themselves, custom shaders still get the wrap mode
+                GLStateCache::bindSampler(0, renderComp.repeatX ? SamplerType::Repeat : SamplerType::ClampToBorder);
+                shader.set(uniforms.texture, 0);
+                shader.set(uniforms.uvOffset, renderComp.uvOffset);
+                shader.set(uniforms.atlasRect, renderComp.atlasRect);
+                shader.set(uniforms.repeatTexture, renderComp.repeatX ? 1 : 0);
             }
-        };
 
-    private:
-        bool sortRenderEntities = false;
+            MeshPool::get(renderComp.shape).draw();
+        }
+
+        std::unique_ptr<SpriteBatch> sprite_batch; ///< Created lazily on the first frame, needs a GL context.
+        std::unique_ptr<RenderQueue> render_queue; ///< Created lazily on the first frame, after the registry.
+        std::vector<RenderQueue::VisibleEntity> visible_entities; ///< Reused every frame to avoid allocations.
     };
 } // namespace gl3::engine::rendering
@@ -1,6 +1,10 @@
 #pragma once
 
 #include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 #include <filesystem>
 #include "glad/glad.h"
 #include "glm/glm.hpp"
@@ -9,12 +13,36 @@ namespace fs = std::filesystem;
 
 namespace gl3::engine::rendering
 {
+    /**
+     * @brief Typed location of a uniform, resolved once via @ref Shader::getUniform and reused every frame.
+     * @tparam T The C++ type of the uniform value (int, float, glm::vec2/3/4 or glm::mat4).
+     * @note An invalid handle (location -1) is silently ignored by OpenGL when set.
+     */
+    template <typename T>
+    struct UniformHandle
+    {
+        GLint location = -1;
+
+        /// @return True if the uniform is active in the shader program.
+        [[nodiscard]] bool isValid() const { return location >= 0; }
+    };
+
+    /**
+     * @brief Final vertex and fragment shader sources, defines already injected. @see Shader::loadSource
+     */
+    struct ShaderSources
+    {
+        std::string vertex;
+        std::string fragment;
+    };
+
     /**
      * @class Shader
      * @brief Manages an OpenGL shader program, including loading, compiling, and setting uniforms.
      *
      * This class loads vertex and fragment shaders from files, compiles them, links them into a program,
      * and provides methods to activate the shader and set uniform variables.
+     * Active uniforms are reflected once at link time, so setting a uniform never queries OpenGL for its location.
      */
     class Shader
     {
@@ -23,8 +51,27 @@ namespace gl3::engine::rendering
          * @brief Constructs and compiles a shader program from vertex and fragment shader source files.
          * @param vertexShaderPath Path to the vertex shader file.
          * @param fragmentShaderPath Path to the fragment shader file.
+         * @param defines Preprocessor defines (e.g. "USE_TEXTURE" or "LAYERS 4") injected after the #version line.
+         * @throws std::runtime_error If compiling or linking fails.
+         * @note Prefer @ref ShaderCache::get, which shares one program between all users of the same sources.
          */
-        Shader(const fs::path& vertexShaderPath, const fs::path& fragmentShaderPath);
+        Shader(const fs::path& vertexShaderPath, const fs::path& fragmentShaderPath,
+               const std::vector<std::string>& defines = {});
+
+        /**
+         * @brief Constructs and compiles a shader program from sources that are already loaded.
+         * @param sources The vertex and fragment shader sources.
+         * @throws std::runtime_error If compiling or linking fails.
+         */
+        explicit Shader(const ShaderSources& sources);
+
+        /**
+         * @brief Constructs a shader program from a binary previously retrieved with getBinary().
+         * @param binaryFormat The driver specific binary format.
+         * @param binary The program binary.
+         * @throws std::runtime_error If the driver rejects the binary (e.g. after a driver update).
+         */
+        Shader(GLenum binaryFormat, const std::vector<char>& binary);
 
         /**
          * @brief Destructor that deletes the shader program and its shaders.
@@ -43,8 +90,96 @@ namespace gl3::engine::rendering
             std::swap(this->shader_program, other.shader_program);
             std::swap(this->vertex_shader, other.vertex_shader);
             std::swap(this->fragment_shader, other.fragment_shader);
+            std::swap(this->uniforms, other.uniforms);
+            std::swap(this->reported_uniforms, other.reported_uniforms);
+        }
+
+        /**
+         * @brief Resolve a uniform once, to set it later without any name lookup.
+         * Reports a missing uniform or a type mismatch once per name.
+         * @tparam T The C++ type of the uniform value.
+         * @param name Name of the uniform in the shader.
+         * @return The typed handle, invalid if the uniform is not active in the program.
+         */
+        template <typename T>
+        [[nodiscard]] UniformHandle<T> getUniform(const std::string& name) const
+        {
+            const auto it = uniforms.find(name);
+            if (it == uniforms.end())
+            {
+                reportUniform(name, "not found or not used in shader");
+                return {};
+            }
+            if (!isCompatibleType<T>(it->second.type))
+            {
+                reportUniform(name, "has a different type in the shader than requested");
+            }
+            return {it->second.location};
         }
 
+        /**
+         * @brief Resolve a uniform that may not exist in every shader using it, without reporting it as missing.
+         * @tparam T The C++ type of the uniform value.
+         * @param name Name of the uniform in the shader.
+         * @return The typed handle, invalid if the uniform is not active in the program.
+         */
+        template <typename T>
+        [[nodiscard]] UniformHandle<T> findUniform(const std::string& name) const
+        {
+            const auto it = uniforms.find(name);
+            return it == uniforms.end() ? UniformHandle<T>{} : UniformHandle<T>{it->second.location};
+        }
+
+        /**
+         * @brief Check that the program uses all uniforms a caller is going to set, reporting every missing one once.
+         * Call this right after loading a shader to surface typos or uniforms optimized away by the compiler.
+         * @param names Names of the expected uniforms.
+         * @return True if all uniforms are active.
+         */
+        bool expectUniforms(const std::vector<std::string>& names) const;
+
+        /**
+         * @brief Set a mat4 uniform via its handle.
+         * @param handle The uniform.
+         * @param matrix The matrix to set.
+         */
+        void set(UniformHandle<glm::mat4> handle, const glm::mat4& matrix) const;
+
+        /**
+         * @brief Set a float uniform via its handle.
+         * @param handle The uniform.
+         * @param value Value to set.
+         */
+        void set(UniformHandle<float> handle, float value) const;
+
+        /**
+         * @brief Set an int, bool or sampler uniform via its handle.
+         * @param handle The uniform.
+         * @param value Value to set.
+         */
+        void set(UniformHandle<int> handle, int value) const;
+
+        /**
+         * @brief Set a vec2 uniform via its handle.
+         * @param handle The uniform.
+         * @param value Value to set.
+         */
+        void set(UniformHandle<glm::vec2> handle, const glm::vec2& value) const;
+
+        /**
+         * @brief Set a vec3 uniform via its handle.
+         * @param handle The uniform.
+         * @param value Value to set.
+         */
+        void set(UniformHandle<glm::vec3> handle, const glm::vec3& value) const;
+
+        /**
+         * @brief Set a vec4 uniform via its handle.
+         * @param handle The uniform.
+         * @param value Value to set.
+         */
+        void set(UniformHandle<glm::vec4> handle, const glm::vec4& value) const;
+
         /**
          * @brief Set a mat4 uniform variable in the shader.
          * @param uniformName Name of the uniform in the shader.
@@ -100,14 +235,84 @@ namespace gl3::engine::rendering
          */
         void use() const;
 
+        /**
+         * @brief Retrieve the linked program as a driver specific binary, e.g. to store it on disk.
+         * @param binaryFormat Receives the binary format of the returned data.
+         * @return The program binary, empty if the driver does not provide one.
+         */
+        [[nodiscard]] std::vector<char> getBinary(GLenum& binaryFormat) const;
+
+        /**
+         * @brief Read a shader source file and inject the given defines after its #version line.
+         * @param shaderPath Path to the shader source file.
+         * @param defines Preprocessor defines to inject.
+         * @return The final shader source.
+         */
+        static std::string loadSource(const fs::path& shaderPath, const std::vector<std::string>& defines);
+
     private:
         /**
-         * @brief Load and compile a single shader stage.
+         * @brief Compile a single shader stage.
          * @param shaderType OpenGL shader type (e.g., GL_VERTEX_SHADER).
-         * @param shaderPath Path to the shader source file.
+         * @param shaderSource The shader source code.
          * @return OpenGL shader ID.
          */
-        static unsigned int loadAndCompileShader(GLuint shaderType, const fs::path& shaderPath);
+        static unsigned int compileShader(GLuint shaderType, const std::string& shaderSource);
+
+        /**
+         * @brief Check the link status of the program and throw on failure.
+         */
+        void checkLinkStatus() const;
+
+        /**
+         * @brief Reflection of one active uniform.
+         */
+        struct UniformInfo
+        {
+            GLint location = -1;
+            GLenum type = 0;
+        };
+
+        /**
+         * @brief Enumerate all active uniforms of the linked program into the location table.
+         */
+        void reflectUniforms();
+
+        /**
+         * @brief Look up the location of a uniform by name, reporting it once if missing.
+         * @param name Name of the uniform.
+         * @return The location or -1.
+         */
+        GLint locationOf(const std::string& name) const;
+
+        /**
+         * @brief Print a warning about a uniform, only the first time for each name.
+         * @param name Name of the uniform.
+         * @param problem Description of the problem.
+         */
+        void reportUniform(const std::string& name, const char* problem) const;
+
+        /**
+         * @brief Check if a reflected GL uniform type can be set with a value of type T.
+         */
+        template <typename T>
+        static bool isCompatibleType(const GLenum type)
+        {
+            if constexpr (std::is_same_v<T, int>)
+                return type == GL_INT || type == GL_BOOL || type == GL_SAMPLER_2D;
+            else if constexpr (std::is_same_v<T, float>)
+                return type == GL_FLOAT;
+            else if constexpr (std::is_same_v<T, glm::vec2>)
+                return type == GL_FLOAT_VEC2;
+            else if constexpr (std::is_same_v<T, glm::vec3>)
+                return type == GL_FLOAT_VEC3;
+            else if constexpr (std::is_same_v<T, glm::vec4>)
+                return type == GL_FLOAT_VEC4;
+            else if constexpr (std::is_same_v<T, glm::mat4>)
+                return type == GL_FLOAT_MAT4;
+            else
+                return false;
+        }
 
         /**
          * @brief Read a text file into a string.
@@ -119,5 +324,7 @@ namespace gl3::engine::rendering
         unsigned int shader_program = 0;     ///< OpenGL shader program ID.
         unsigned int vertex_shader = 0;      ///< Vertex shader ID.
         unsigned int fragment_shader = 0;    ///< Fragment shader ID.
+        std::unordered_map<std::string, UniformInfo> uniforms; ///< Active uniforms by name, filled at link time.
+        mutable std::unordered_set<std::string> reported_uniforms; ///< Uniforms already reported as problematic.
     };
 }
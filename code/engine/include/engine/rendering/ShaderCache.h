@@ -0,0 +1,99 @@
+#pragma once
+
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "engine/rendering/Shader.h"
+
+namespace gl3::engine::rendering
+{
+    /**
+     * @brief Shared, reference counted handle to a cached shader program.
+     */
+    using ShaderHandle = std::shared_ptr<const Shader>;
+
+    /**
+     * @class ShaderCache
+     * @brief Static class that compiles every shader program only once and shares it between all users.
+     *
+     * Programs are keyed by vertex path, fragment path and defines. Optionally, linked programs are also stored on disk
+     * as glProgramBinary blobs, so a warm start can skip GLSL compilation entirely.
+     */
+    class ShaderCache
+    {
+    public:
+        /**
+         * @brief Get the shader program for the given sources, compiling it on first use.
+         * @param vertexShaderPath Path to the vertex shader file.
+         * @param fragmentShaderPath Path to the fragment shader file.
+         * @param defines Preprocessor defines injected after the #version line.
+         * @return A shared handle to the program.
+         * @throws std::runtime_error If compiling or linking fails.
+         */
+        static ShaderHandle get(const fs::path& vertexShaderPath, const fs::path& fragmentShaderPath,
+                                const std::vector<std::string>& defines = {});
+
+        /**
+         * @brief Store linked programs as binaries in a directory and reuse them on later starts.
+         * @param directory Directory for the binary files, created if it doesn't exist.
+         * @note Binaries are keyed by a hash of the final sources and the GL renderer/version, so edited shaders or a
+         * driver update simply cause a recompile.
+         */
+        static void enableProgramBinaryCache(const fs::path& directory);
+
+        /**
+         * @brief Stop reading and writing program binaries.
+         */
+        static void disableProgramBinaryCache();
+
+        /**
+         * @brief Delete all programs that are not referenced outside the cache anymore.
+         * @return Number of released programs.
+         */
+        static size_t releaseUnused();
+
+        /**
+         * @brief Drop all cached programs. Programs still referenced stay alive until their last handle is released.
+         */
+        static void clear();
+
+        /**
+         * @return Number of cached programs.
+         */
+        static size_t size() { return shader_cache.size(); }
+
+    private:
+        /**
+         * @brief Build the cache key of a program.
+         */
+        static std::string makeKey(const fs::path& vertexShaderPath, const fs::path& fragmentShaderPath,
+                                   const std::vector<std::string>& defines);
+
+        /**
+         * @brief Try to create a program from its on-disk binary.
+         * @param vertexSource Final vertex shader source.
+         * @param fragmentSource Final fragment shader source.
+         * @return The program or nullptr if no valid binary exists.
+         */
+        static ShaderHandle loadBinary(const std::string& vertexSource, const std::string& fragmentSource);
+
+        /**
+         * @brief Write the binary of a linked program to disk.
+         * @param vertexSource Final vertex shader source.
+         * @param fragmentSource Final fragment shader source.
+         * @param shader The linked program.
+         */
+        static void storeBinary(const std::string& vertexSource, const std::string& fragmentSource,
+                                const Shader& shader);
+
+        /**
+         * @brief Path of the binary file for the given sources.
+         */
+        static fs::path binaryPath(const std::string& vertexSource, const std::string& fragmentSource);
+
+        static std::unordered_map<std::string, ShaderHandle> shader_cache; ///< Programs by cache key.
+        static fs::path binary_cache_directory; ///< Empty if the binary cache is disabled.
+    };
+}
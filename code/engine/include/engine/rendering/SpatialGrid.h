@@ -0,0 +1,135 @@
+#pragma once
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+#include <entt/entt.hpp>
+
+namespace gl3::engine::rendering
+{
+    /**
+     * @class SpatialGrid
+     * @brief Uniform 1D grid over the world x axis, to find the entities overlapping the camera window.
+     *
+     * Levels are long horizontal strips, so only x is bucketed. An entity is stored in every cell its x extent
+     * overlaps. Moving it inside the same cells costs a single lookup, only crossing a cell border relinks it.
+     * Queries only visit the cells overlapping the requested range, so their cost scales with the visible entities
+     * instead of the level length.
+     */
+    class SpatialGrid
+    {
+    public:
+        /**
+         * @brief Create an empty grid.
+         * @param cellSize Width of one cell in world units (meters).
+         */
+        explicit SpatialGrid(float cellSize = defaultCellSize);
+
+        /**
+         * @brief Insert an entity or move it to the cells of its new x extent.
+         * @param entity The entity.
+         * @param minX Left edge in world units.
+         * @param maxX Right edge in world units.
+         */
+        void place(entt::entity entity, float minX, float maxX);
+
+        /**
+         * @brief Remove an entity from the grid, does nothing if it was never placed.
+         * @param entity The entity.
+         */
+        void remove(entt::entity entity);
+
+        /**
+         * @brief Remove all entities.
+         */
+        void clear();
+
+        /**
+         * @brief Call a function once for every entity stored in a cell overlapping an x range.
+         * The cells are coarse, so callers still have to test the exact bounds of the reported entities.
+         * @param minX Left edge of the range in world units.
+         * @param maxX Right edge of the range in world units.
+         * @param func Called with each entt::entity.
+         */
+        template <typename Func>
+        void query(const float minX, const float maxX, Func&& func) const
+        {
+            for (const auto entity : wide_entities)
+            {
+                func(entity);
+            }
+            if (cells.empty()) return;
+
+            const int from = std::max(cellOf(minX), first_cell);
+            const int to = std::min(cellOf(maxX), first_cell + static_cast<int>(cells.size()) - 1);
+            for (int cell = from; cell <= to; ++cell)
+            {
+                for (const auto& [entity, entityFirstCell] : cells[cell - first_cell])
+                {
+                    // An entity spanning several cells is only reported from the first queried one
+                    if (std::max(entityFirstCell, from) == cell) func(entity);
+                }
+            }
+        }
+
+        /// @return Number of placed entities.
+        [[nodiscard]] size_t size() const { return placements.size(); }
+
+        /// @return Width of one cell in world units.
+        [[nodiscard]] float getCellSize() const { return cell_size; }
+
+        /// Default cell width in world units, about a quarter of the camera window.
+        static constexpr float defaultCellSize = 4.f;
+
+        /// Entities spanning more cells than this are kept in a list checked by every query instead.
+        static constexpr int maxCellsPerEntity = 64;
+
+    private:
+        /**
+         * @brief An entity stored in a cell.
+         */
+        struct CellEntry
+        {
+            entt::entity entity;
+            int firstCell; ///< First cell of the entity, used to report it only once per query.
+        };
+
+        /**
+         * @brief The cells an entity is stored in.
+         */
+        struct Placement
+        {
+            int firstCell = 0;
+            int lastCell = 0;
+            bool isWide = false; ///< Stored in wide_entities instead of the cells.
+        };
+
+        /**
+         * @param x World x position.
+         * @return Index of the cell containing x.
+         */
+        [[nodiscard]] int cellOf(float x) const;
+
+        /**
+         * @brief Get a cell, growing the grid to either side if needed.
+         * @param index Index of the cell.
+         * @return The cell.
+         */
+        std::vector<CellEntry>& getCell(int index);
+
+        /**
+         * @brief Add an entity to its cells.
+         */
+        void link(entt::entity entity, const Placement& placement);
+
+        /**
+         * @brief Remove an entity from its cells.
+         */
+        void unlink(entt::entity entity, const Placement& placement);
+
+        float cell_size;
+        int first_cell = 0; ///< Index of cells[0].
+        std::vector<std::vector<CellEntry>> cells;
+        std::vector<entt::entity> wide_entities;
+        std::unordered_map<entt::entity, Placement> placements;
+    };
+}
@@ -0,0 +1,134 @@
+#pragma once
+#include <vector>
+#include <glm/glm.hpp>
+#include "glad/glad.h"
+#include "engine/rendering/MeshPool.h"
+#include "engine/rendering/ShaderCache.h"
+
+namespace gl3::engine::rendering
+{
+    /**
+     * @brief Per-instance data of one sprite, laid out exactly as it is uploaded to the instance buffer.
+     */
+    struct SpriteInstance
+    {
+        glm::mat4 model = glm::mat4(1.f); ///< Model transform in pixel space.
+        glm::vec4 uvRect = {0.f, 0.f, 1.f, 1.f}; ///< (u_min, v_min, u_max, v_max) mapped onto the unit mesh.
+        glm::vec4 color = {1.f, 0.f, 0.f, 1.f}; ///< Base color, used if the sprite has no texture.
+        glm::vec4 uvParams = {0.f, 0.f, 0.f, 0.f}; ///< xy: parallax uv offset, z: 1 if textured, w: 1 if repeating.
+        glm::vec4 atlasRect = {0.f, 0.f, 1.f, 1.f}; ///< Rect of the image inside the texture, uvs are local to it.
+    };
+
+    /**
+     * @brief Render state shared by all instances of one instanced draw call.
+     */
+    struct SpriteBatchKey
+    {
+        GLuint texture = 0; ///< OpenGL texture ID (usually an atlas page), 0 for untextured sprites.
+        SpriteShape shape = SpriteShape::Quad; ///< Unit mesh to draw.
+
+        auto operator<=>(const SpriteBatchKey&) const = default;
+    };
+
+    /**
+     * @class SpriteBatch
+     * @brief Collects sprites into a per-frame instance buffer and draws them with one instanced call per render state.
+     *
+     * Sprites are submitted in back to front order. Everything submitted between two flush() calls is treated as one
+     * layer: inside it, sprites are grouped by their SpriteBatchKey (keeping submission order inside a group) and every
+     * group is drawn with a single glDrawElementsInstancedBaseInstance call.
+     * Flush whenever the z-layer changes or something is drawn outside the batch, to keep the back to front order.
+     */
+    class SpriteBatch
+    {
+    public:
+        /**
+         * @brief Creates the instanced sprite shader, the instanced VAOs and the instance buffer.
+         * @note Needs a current OpenGL context.
+         */
+        SpriteBatch();
+
+        /**
+         * @brief Releases all GPU resources of the batch.
+         */
+        ~SpriteBatch();
+
+        SpriteBatch(const SpriteBatch&) = delete;
+        SpriteBatch& operator=(const SpriteBatch&) = delete;
+
+        /**
+         * @brief Starts a new frame.
+         * @note The camera comes from the FrameCamera uniform buffer, which the Context updates every frame.
+         */
+        void begin();
+
+        /**
+         * @brief Queue a sprite for drawing.
+         * @param key The render state of the sprite.
+         * @param instance The per-instance data of the sprite.
+         */
+        void submit(const SpriteBatchKey& key, const SpriteInstance& instance);
+
+        /**
+         * @brief Draws all queued sprites, one instanced draw call per render state.
+         */
+        void flush();
+
+        /// @return Number of instanced draw calls issued since the last begin().
+        [[nodiscard]] size_t getDrawCallCount() const { return draw_calls; }
+
+        /// @return Number of sprites drawn since the last begin().
+        [[nodiscard]] size_t getSpriteCount() const { return sprite_count; }
+
+    private:
+        /**
+         * @brief A VAO combining a shared unit mesh from the MeshPool with the per-instance attributes.
+         */
+        struct UnitGeometry
+        {
+            GLuint VAO = 0;
+            GLsizei indexCount = 0;
+        };
+
+        /**
+         * @brief A queued sprite together with its render state.
+         */
+        struct PendingSprite
+        {
+            SpriteBatchKey key;
+            SpriteInstance instance;
+        };
+
+        /**
+         * @brief Sets up an instanced VAO reading vertices from a unit mesh and instances from the instance buffer.
+         * @param mesh The shared unit mesh.
+         * @return The created geometry.
+         */
+        [[nodiscard]] UnitGeometry createGeometry(const Mesh& mesh) const;
+
+        /**
+         * @brief Grows the instance buffer if needed and uploads all instances of the current flush.
+         */
+        void uploadInstances();
+
+        /**
+         * @brief Issues one instanced draw call for a run of sprites sharing the same key.
+         * @param key Render state of the run.
+         * @param first Index of the first instance in the instance buffer.
+         * @param count Number of instances in the run.
+         */
+        void drawRun(const SpriteBatchKey& key, size_t first, size_t count);
+
+        ShaderHandle shader; ///< Instanced sprite shader.
+        UniformHandle<int> texture_uniform;
+        UnitGeometry quad; ///< Unit quad.
+        UnitGeometry triangle; ///< Unit triangle.
+        GLuint instance_buffer = 0; ///< Per-frame instance buffer.
+        size_t instance_capacity = 0; ///< Capacity of the instance buffer in instances.
+
+        std::vector<PendingSprite> pending; ///< Sprites queued since the last flush.
+        std::vector<SpriteInstance> instance_data; ///< Sorted instance data of the current flush.
+        size_t draw_calls = 0;
+        size_t sprite_count = 0;
+    };
+}
@@ -7,6 +7,19 @@
 
 namespace gl3::engine::rendering
 {
+    class BakedTexture;
+
+    /**
+     * @brief Decoded RGBA8 image, rows stored bottom to top like OpenGL expects them.
+     */
+    struct ImageData
+    {
+        int width = 0; ///< Width in pixels.
+        int height = 0; ///< Height in pixels.
+        int channels = 4; ///< Channels of the source file, the pixels always have 4.
+        std::vector<unsigned char> pixels; ///< width * height * 4 bytes.
+    };
+
     /**
      * @class Texture
      * @brief Manages a 2D OpenGL texture, with optional support for tile-based UV mapping.
@@ -25,6 +38,52 @@ namespace gl3::engine::rendering
          */
         explicit Texture(const std::string& path, int tilesX = 0, int tilesY = 0);
 
+        /**
+         * @brief Construct a new Texture from already decoded pixels, e.g. a packed texture atlas page.
+         * @param image The decoded image.
+         * @param name Name of the texture, a name containing "tileset" marks it as tileset.
+         * @param tilesX Number of horizontal tiles if using a tileset (default 0 for none).
+         * @param tilesY Number of vertical tiles if using a tileset (default 0 for none).
+         */
+        Texture(const ImageData& image, const std::string& name, int tilesX = 0, int tilesY = 0);
+
+        /**
+         * @brief Construct a new Texture from RGBA8 pixels staged in a pixel unpack buffer (at offset 0).
+         * @param width Width in pixels.
+         * @param height Height in pixels.
+         * @param unpackBuffer The pixel unpack buffer holding the pixels.
+         * @param name Name of the texture, a name containing "tileset" marks it as tileset.
+         * @param tilesX Number of horizontal tiles if using a tileset (default 0 for none).
+         * @param tilesY Number of vertical tiles if using a tileset (default 0 for none).
+         * @note Only level 0 is uploaded, call generateMipmaps() later (e.g. on the next frame).
+         */
+        Texture(int width, int height, GLuint unpackBuffer, const std::string& name, int tilesX = 0, int tilesY = 0);
+
+        /**
+         * @brief Construct a new Texture from a baked texture, uploading its mip levels straight from the mapping.
+         * @param baked The baked texture, its tile grid decides if the texture is a tileset.
+         * @param name Name of the texture.
+         */
+        Texture(const BakedTexture& baked, const std::string& name);
+
+        /**
+         * @brief Parse the tile grid of a tileset from its file name, e.g. "tileset_9x9.png".
+         * @param fileName The file name.
+         * @param tilesX Receives the horizontal tile count if the name contains a grid, otherwise unchanged.
+         * @param tilesY Receives the vertical tile count if the name contains a grid, otherwise unchanged.
+         * @return True if the name marks a tileset.
+         */
+        static bool parseTileGrid(const std::string& fileName, int& tilesX, int& tilesY);
+
+        /**
+         * @brief Decode an image file into RGBA8 pixels, flipped vertically for OpenGL.
+         * @param path Path to the image file.
+         * @return The decoded image.
+         * @throws std::runtime_error If the file can't be decoded.
+         * @note Thread safe, does not touch OpenGL.
+         */
+        [[nodiscard]] static ImageData loadImage(const std::string& path);
+
         /**
          * @brief Destroy the Texture and free OpenGL resources.
          */
@@ -55,6 +114,14 @@ namespace gl3::engine::rendering
          */
         void bind(GLuint slot = 0) const;
 
+        /**
+         * @brief Generate the mip chain of a texture created without one. Does nothing if it already has mipmaps.
+         */
+        void generateMipmaps();
+
+        /// @return True if the mip chain was generated.
+        [[nodiscard]] bool hasMipmaps() const { return has_mipmaps; }
+
         /**
          * @brief Get the OpenGL texture ID.
          * @return Texture ID.
@@ -104,10 +171,35 @@ namespace gl3::engine::rendering
         [[nodiscard]] const std::vector<glm::vec4>& getTileUVs() const { return tile_uvs; }
 
     private:
+        /**
+         * @brief Create the GL texture object and upload the pixels with mipmaps.
+         * @param image The decoded image.
+         */
+        void upload(const ImageData& image);
+
+        /**
+         * @brief Create the GL texture object and upload level 0.
+         * @param imageWidth Width in pixels.
+         * @param imageHeight Height in pixels.
+         * @param internalFormat GL internal format.
+         * @param pixels RGBA8 pixels, or an offset into the bound pixel unpack buffer.
+         * @param mipmaps Generate the mip chain right away.
+         */
+        void upload(int imageWidth, int imageHeight, GLint internalFormat, const void* pixels, bool mipmaps);
+
+        /**
+         * @brief Detect a tileset by its name and precompute its tile UVs.
+         * @param name Name or path of the texture.
+         * @param tilesX Number of horizontal tiles.
+         * @param tilesY Number of vertical tiles.
+         */
+        void setupTiles(const std::string& name, int tilesX, int tilesY);
+
         GLuint ID = 0;                          ///< OpenGL texture ID.
         int width = 0;                          ///< Width in pixels.
         int height = 0;                         ///< Height in pixels.
         bool is_tileset = false;                ///< True if texture is a tileset.
+        bool has_mipmaps = false;               ///< True once the mip chain was generated.
         std::vector<glm::vec4> tile_uvs;        ///< Precomputed UVs for tileset.
         std::string file_name;                  ///< Original file name.
     };
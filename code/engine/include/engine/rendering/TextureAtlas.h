@@ -0,0 +1,151 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <glm/glm.hpp>
+#include "engine/rendering/Texture.h"
+
+namespace gl3::engine::rendering
+{
+    /**
+     * @brief A texture as seen by the renderer: a GL texture (own texture or atlas page) plus the rect it occupies.
+     *
+     * Level data keeps uvs local to the original image (0 to 1, tile uvs of a tileset), the rect maps them into
+     * the page. Shaders wrap or clamp inside the rect themselves, so repeating textures work inside an atlas too.
+     */
+    struct TextureRegion
+    {
+        const Texture* texture = nullptr; ///< The GL texture holding the image.
+        glm::vec4 rect = {0.f, 0.f, 1.f, 1.f}; ///< (u_min, v_min, u_max, v_max) of the image inside the texture.
+        int width = 0; ///< Width of the original image in pixels.
+        int height = 0; ///< Height of the original image in pixels.
+        std::vector<glm::vec4> tileUVs; ///< Local uvs of every tile if the image is a tileset.
+
+        /**
+         * @brief Map a local uv rect of the original image into the uv space of the texture.
+         * @param localUV (u_min, v_min, u_max, v_max) in the original image.
+         * @return The same rect in the texture's uv space.
+         */
+        [[nodiscard]] glm::vec4 toTextureUV(const glm::vec4& localUV) const
+        {
+            const glm::vec2 size = {rect.z - rect.x, rect.w - rect.y};
+            return {
+                rect.x + localUV.x * size.x, rect.y + localUV.y * size.y,
+                rect.x + localUV.z * size.x, rect.y + localUV.w * size.y
+            };
+        }
+
+        /// @return True if the image is a tileset.
+        [[nodiscard]] bool isTileSet() const { return !tileUVs.empty(); }
+    };
+
+    /**
+     * @class TextureAtlas
+     * @brief Packs many small images into a few large atlas pages using skyline bottom-left packing.
+     *
+     * Images are queued with add() and packed all at once by build(), tallest first. Each image gets a border of
+     * extruded edge pixels, so bilinear filtering and the first mip levels don't bleed neighbouring images in.
+     */
+    class TextureAtlas
+    {
+    public:
+        /**
+         * @brief Create an empty atlas.
+         * @param pageSize Width and height of one page in pixels, clamped to GL_MAX_TEXTURE_SIZE.
+         * @param padding Extruded border around every image in pixels.
+         */
+        explicit TextureAtlas(int pageSize = 2048, int padding = 4);
+
+        /**
+         * @brief Check if an image is small enough to be packed.
+         * @param width Image width in pixels.
+         * @param height Image height in pixels.
+         * @return True if the image fits on a page including its padding.
+         */
+        [[nodiscard]] bool fits(int width, int height) const;
+
+        /**
+         * @brief Queue an image for packing.
+         * @param key Lookup key of the image.
+         * @param image The decoded image, must fit on a page.
+         * @param tileUVs Local tile uvs if the image is a tileset.
+         */
+        void add(const std::string& key, ImageData image, std::vector<glm::vec4> tileUVs = {});
+
+        /**
+         * @brief Pack all queued images and upload the pages. Queued pixel data is released afterward.
+         */
+        void build();
+
+        /**
+         * @brief Get the region of a packed image.
+         * @param key Lookup key of the image.
+         * @return The region, nullptr if the image is not in the atlas (or build() wasn't called yet).
+         */
+        [[nodiscard]] const TextureRegion* find(const std::string& key) const;
+
+        /// @return All packed regions by key.
+        [[nodiscard]] const std::unordered_map<std::string, TextureRegion>& getRegions() const { return regions; }
+
+        /// @return The uploaded atlas pages.
+        [[nodiscard]] const std::vector<std::unique_ptr<Texture>>& getPages() const { return pages; }
+
+    private:
+        /**
+         * @brief A segment of the skyline: the top edge of everything packed below it.
+         */
+        struct SkylineNode
+        {
+            int x;
+            int y;
+            int width;
+        };
+
+        /**
+         * @brief A page being packed.
+         */
+        struct PageBuilder
+        {
+            ImageData image;
+            std::vector<SkylineNode> skyline;
+        };
+
+        /**
+         * @brief An image waiting to be packed.
+         */
+        struct PendingImage
+        {
+            std::string key;
+            ImageData image;
+            std::vector<glm::vec4> tileUVs;
+        };
+
+        /**
+         * @brief Find the lowest (then leftmost) position for a rect and add it to the skyline.
+         * @param page The page to pack into.
+         * @param width Width of the rect including padding.
+         * @param height Height of the rect including padding.
+         * @param outX Receives the x position of the rect.
+         * @param outY Receives the y position of the rect.
+         * @return False if the rect doesn't fit on the page anymore.
+         */
+        bool insert(PageBuilder& page, int width, int height, int& outX, int& outY) const;
+
+        /**
+         * @brief Copy an image into a page and extrude its edge pixels into the padding.
+         * @param page The destination page.
+         * @param image The image to copy.
+         * @param x Left edge of the image (inside the padding).
+         * @param y Bottom edge of the image (inside the padding).
+         */
+        void blit(ImageData& page, const ImageData& image, int x, int y) const;
+
+        int page_size;
+        int padding;
+        std::vector<PendingImage> pending;
+        std::unordered_map<std::string, TextureRegion> regions;
+        std::vector<std::unique_ptr<Texture>> pages;
+    };
+}
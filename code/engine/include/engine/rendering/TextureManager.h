@@ -1,9 +1,15 @@
 #pragma once
 
 #include <filesystem>
+#include <memory>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include "engine/Events.h"
 #include "engine/rendering/Texture.h"
+#include "engine/rendering/TextureAtlas.h"
+#include "engine/rendering/TextureStreamer.h"
 
 namespace gl3::engine::rendering
 {
@@ -13,19 +19,28 @@ namespace gl3::engine::rendering
   *
   * This manager handles texture reuse and lifetime. It supports general textures,
   * tilesets, UI textures, and background textures, organized in separate caches.
+  * Level textures and tilesets loaded on start up are packed into shared atlas pages, so sprites using different
+  * textures can still be drawn in one batch. They are handed out as TextureRegions.
+  * Start up loading can run in the background: images are decoded on worker threads and uploaded a few per frame
+  * by update(). Getters finish loading a texture that is still on its way on demand.
   */
  class TextureManager
  {
  public:
+  /**
+   * @brief Images up to this size (in pixels, both sides) loaded by loadTextures() are packed into the atlas.
+   */
+  static constexpr int maxAtlasImageSize = 1024;
+
   /**
    * @brief Cache for regular textures.
    */
-  static std::unordered_map<std::string, std::unique_ptr<Texture>> texture_cache;
+  static std::unordered_map<std::string, TextureRegion> texture_cache;
 
   /**
    * @brief Cache for tileset textures.
    */
-  static std::unordered_map<std::string, std::unique_ptr<Texture>> tile_set_cache;
+  static std::unordered_map<std::string, TextureRegion> tile_set_cache;
 
   /**
    * @brief Cache for UI-specific textures.
@@ -47,11 +62,45 @@ namespace gl3::engine::rendering
   static void add(const std::string& key, const std::filesystem::path& path, int tilesX = 8, int tilesY = 8);
 
   /**
-   * @brief Loads all textures from assets/backgroundTextures, assets/textures and assets/uiTextures.
+   * @brief Loads all textures from assets/backgroundTextures, assets/textures and assets/uiTextures and builds the
+   * texture atlas.
    * @note Be careful to only put textures in these folders that you really need. they all will be loaded once on start up
    */
   static void loadTextures();
 
+  /**
+   * @brief Start loading all textures from assets/uiTextures, assets/textures and assets/backgroundTextures in the
+   * background (in this order). Call update() every frame to move finished images to the GPU.
+   * @note The atlas is built as soon as all level textures are decoded.
+   */
+  static void loadTexturesAsync();
+
+  /**
+   * @brief Upload textures decoded since the last call and generate mipmaps of the previous uploads.
+   * Call once per frame on the main thread while loading.
+   * @param uploadBudget Maximum number of textures uploaded in this call.
+   */
+  static void update(size_t uploadBudget = 4);
+
+  /**
+   * @brief Block until all queued textures are loaded and the atlas is built.
+   */
+  static void finishLoading();
+
+  /// @return True while textures are decoded or waiting for their upload.
+  [[nodiscard]] static bool isLoading() { return streamer != nullptr; }
+
+  /// @return Loading progress from 0 to 1, 1 if nothing is loading.
+  [[nodiscard]] static float getLoadProgress()
+  {
+   return load_total == 0 ? 1.f : static_cast<float>(load_done) / static_cast<float>(load_total);
+  }
+
+  /**
+   * @brief Invoked with (loaded, total) whenever a texture finished loading in the background.
+   */
+  static events::Event<TextureManager, size_t, size_t> onLoadProgress;
+
   /**
    * @brief Add all textures from a folder to their according texture cache, defined by their parent folder name (ui, background, etc.).
    * @param textureFolderPath Path to the folder.
@@ -59,21 +108,23 @@ namespace gl3::engine::rendering
   static void addAllTexturesFromFolder(const std::filesystem::path& textureFolderPath);
 
   /**
-   * @brief Get a texture from either the general cache or the tileset cache.
+   * @brief Get a texture from either the general cache, the tileset cache or the background cache.
+   * Waits for all level textures and builds the atlas if they are still loading.
    * @param key Lookup key.
-   * @return Pointer to the Texture if found, nullptr otherwise.
+   * @return Pointer to the TextureRegion.
+   * @throws std::runtime_error If the key is not found.
    */
-  static const Texture* getTileOrSingleTex(const std::string& key);
+  static const TextureRegion* getTileOrSingleTex(const std::string& key);
 
   /**
-   * @brief Get a UI texture by key.
+   * @brief Get a UI texture by key, finishes loading it first if it is still on its way.
    * @param key Lookup key.
    * @return Pointer to the Texture if found, nullptr otherwise.
    */
   static const Texture* getUITexture(const std::string& key);
 
   /**
-   * @brief Get a background texture by key.
+   * @brief Get a background texture by key, finishes loading it first if it is still on its way.
    * @param key Lookup key.
    * @return Pointer to the Texture if found, nullptr otherwise.
    */
@@ -83,7 +134,7 @@ namespace gl3::engine::rendering
    * @brief Get all general textures.
    * @return Const reference to the texture cache.
    */
-  static const std::unordered_map<std::string, std::unique_ptr<Texture>>& getAllTextures()
+  static const std::unordered_map<std::string, TextureRegion>& getAllTextures()
   {
    return texture_cache;
   }
@@ -92,7 +143,7 @@ namespace gl3::engine::rendering
    * @brief Get all tileset textures.
    * @return Const reference to the tileset cache.
    */
-  static const std::unordered_map<std::string, std::unique_ptr<Texture>>& getAllTileSets()
+  static const std::unordered_map<std::string, TextureRegion>& getAllTileSets()
   {
    return tile_set_cache;
   }
@@ -115,10 +166,17 @@ namespace gl3::engine::rendering
    return bg_texture_cache;
   }
 
+  /**
+   * @brief Get the texture atlas holding the packed level textures.
+   * @return Pointer to the atlas, nullptr before loadTextures() was called.
+   */
+  static const TextureAtlas* getAtlas() { return atlas.get(); }
+
   /**
    * @brief Load a single texture into its corresponding cache, defined by its parent folder naming.
    * @param key Lookup key.
    * @param path Path to the texture file.
+   * @note Textures loaded after the atlas was built get their own GL texture.
    */
   static void load(const std::string& key, const std::string& path);
 
@@ -126,5 +184,139 @@ namespace gl3::engine::rendering
    * @brief Clear all texture caches.
    */
   static void clear();
+
+ private:
+  /**
+   * @brief Which cache a texture file belongs to.
+   */
+  enum class TextureKind
+  {
+   Texture, ///< Level texture.
+   TileSet, ///< Level tileset.
+   UI, ///< UI texture.
+   Background ///< Background texture.
+  };
+
+  /**
+   * @brief Where a texture file goes and how it is split into tiles.
+   */
+  struct TextureSource
+  {
+   TextureKind kind = TextureKind::Texture;
+   std::string fileName; ///< Lower case file name.
+   int tilesX = 0;
+   int tilesY = 0;
+  };
+
+  /**
+   * @brief Check if a file is a loadable texture and not loaded or loading already.
+   * @param key Lookup key.
+   * @param path Path to the texture file.
+   * @return True if the file should be loaded.
+   */
+  static bool shouldLoad(const std::string& key, const std::filesystem::path& path);
+
+  /**
+   * @brief Find the cache of a texture file by its parent folder and parse the tile grid of tilesets.
+   * @param path Path to the texture file.
+   * @param tilesX Default number of horizontal tiles.
+   * @param tilesY Default number of vertical tiles.
+   * @return The texture source.
+   */
+  static TextureSource classify(const std::filesystem::path& path, int tilesX, int tilesY);
+
+  /**
+   * @brief Move a decoded image into its cache, the atlas queue or a standalone texture.
+   * @param key Lookup key.
+   * @param source Where the texture goes.
+   * @param image The decoded image.
+   * @param deferMipmaps Upload through the streamer and generate the mip chain on the next update().
+   * @param baked The baked texture if there is one, then image is ignored.
+   */
+  static void insert(const std::string& key, const TextureSource& source, ImageData image, bool deferMipmaps,
+                     const BakedTexture* baked = nullptr);
+
+  /**
+   * @brief Insert a finished background decode and report the progress.
+   * @param result The finished decode.
+   * @param deferMipmaps Generate the mip chain on the next update().
+   */
+  static void finalize(TextureStreamer::Result result, bool deferMipmaps);
+
+  /**
+   * @brief Block until a texture that is still loading is inserted. Does nothing if the key isn't loading.
+   * @param key Lookup key.
+   */
+  static void finishPending(const std::string& key);
+
+  /**
+   * @brief Block until all level textures are decoded and build the atlas.
+   */
+  static void finishLevelTextures();
+
+  /**
+   * @brief Stop the streamer once everything is loaded.
+   */
+  static void endLoadingIfDone();
+
+  /**
+   * @brief Pack all queued images into the atlas and point their cache entries at the atlas pages.
+   */
+  static void buildAtlas();
+
+  /**
+   * @brief Create a region covering a whole standalone texture.
+   * @param texture The texture.
+   * @return The region.
+   */
+  static TextureRegion makeRegion(const Texture& texture);
+
+  /**
+   * @brief Atlas holding the packed level textures and tilesets.
+   */
+  static std::unique_ptr<TextureAtlas> atlas;
+
+  /**
+   * @brief True once the atlas pages were uploaded, later textures are not packed anymore.
+   */
+  static bool atlas_built;
+
+  /**
+   * @brief Owner of level textures that have their own GL texture (too large for the atlas or loaded late).
+   */
+  static std::vector<std::unique_ptr<Texture>> standalone_textures;
+
+  /**
+   * @brief Regions of the background textures, for looking them up like level textures.
+   */
+  static std::unordered_map<std::string, TextureRegion> bg_region_cache;
+
+  /**
+   * @brief Keys queued in the atlas, they get their cache entry once the atlas is built.
+   */
+  static std::unordered_set<std::string> pending_atlas_keys;
+
+  /**
+   * @brief Decodes and uploads textures in the background, nullptr when nothing is loading.
+   */
+  static std::unique_ptr<TextureStreamer> streamer;
+
+  /**
+   * @brief Textures handed to the streamer and not inserted yet.
+   */
+  static std::unordered_map<std::string, TextureSource> pending_sources;
+
+  /**
+   * @brief Number of level textures and tilesets in pending_sources, the atlas waits for them.
+   */
+  static size_t pending_level_textures;
+
+  /**
+   * @brief Textures uploaded without a mip chain, generated on the next update().
+   */
+  static std::vector<Texture*> mipmap_queue;
+
+  static size_t load_total; ///< Textures queued by loadTexturesAsync().
+  static size_t load_done; ///< Queued textures that finished loading.
  };
 }
@@ -0,0 +1,138 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+#include "engine/rendering/BakedTexture.h"
+#include "engine/rendering/Texture.h"
+
+namespace gl3::engine::rendering
+{
+    /**
+     * @class TextureStreamer
+     * @brief Decodes image files on a pool of worker threads and uploads them through pixel unpack buffers.
+     *
+     * Images with an up to date bake (see BakedTexture) are memory mapped instead of decoded.
+     * Decoding runs entirely off the main thread. Everything touching OpenGL (upload()) must be called on the thread
+     * owning the GL context, usually spread over several frames by the TextureManager.
+     */
+    class TextureStreamer
+    {
+    public:
+        /**
+         * @brief An image file to decode.
+         */
+        struct Request
+        {
+            std::string key; ///< Lookup key of the texture.
+            std::filesystem::path path; ///< Path to the image file.
+        };
+
+        /**
+         * @brief A finished decode.
+         */
+        struct Result
+        {
+            Request request;
+            ImageData image; ///< The decoded pixels, empty if decoding failed or a bake was found.
+            std::unique_ptr<BakedTexture> baked; ///< The mapped bake of the image, if there is an up to date one.
+            std::string error; ///< Why decoding failed, empty on success.
+        };
+
+        /**
+         * @brief Start the worker threads.
+         * @param workerCount Number of decoding threads, 0 uses all hardware threads but one.
+         */
+        explicit TextureStreamer(unsigned workerCount = 0);
+
+        /**
+         * @brief Stop the worker threads (queued requests are dropped) and release the unpack buffers.
+         * @note Needs the GL context if upload() was used.
+         */
+        ~TextureStreamer();
+
+        TextureStreamer(const TextureStreamer&) = delete;
+        TextureStreamer& operator=(const TextureStreamer&) = delete;
+
+        /**
+         * @brief Queue an image file for decoding. Requests are decoded in order.
+         * @param request The file to decode.
+         */
+        void enqueue(Request request);
+
+        /**
+         * @brief Take a finished decode without blocking.
+         * @return The next finished decode, std::nullopt if none is ready.
+         */
+        std::optional<Result> poll();
+
+        /**
+         * @brief Block until a specific request is decoded and take it.
+         * Requests still waiting in the queue are decoded on the calling thread instead.
+         * @param key Key of the request.
+         * @return The finished decode, std::nullopt if no request with this key is queued, running or finished.
+         */
+        std::optional<Result> wait(const std::string& key);
+
+        /**
+         * @brief Map the baked version of an image, falling back to the image file if it is missing or broken.
+         * @param imagePath Path to the image file.
+         * @return The baked texture, nullptr if the image has to be decoded.
+         */
+        static std::unique_ptr<BakedTexture> openBaked(const std::filesystem::path& imagePath);
+
+        /**
+         * @return Number of requests that were enqueued but not yet taken with poll() or wait().
+         */
+        [[nodiscard]] size_t getOutstandingCount() const;
+
+        /**
+         * @brief Create a texture from decoded pixels, copying them through a pixel unpack buffer.
+         *
+         * The unpack buffers are used round robin and orphaned before writing, so the driver can still read the
+         * previous upload while the next one is written. The mip chain is not generated.
+         * @param image The decoded image.
+         * @param name Name of the texture, a name containing "tileset" marks it as tileset.
+         * @param tilesX Number of horizontal tiles if using a tileset.
+         * @param tilesY Number of vertical tiles if using a tileset.
+         * @return The texture with level 0 uploaded.
+         */
+        std::unique_ptr<Texture> upload(const ImageData& image, const std::string& name, int tilesX = 0,
+                                         int tilesY = 0);
+
+    private:
+        /**
+         * @brief Worker thread loop: decode queued requests until stopped.
+         * @param stopToken Stops the loop.
+         */
+        void work(const std::stop_token& stopToken);
+
+        /**
+         * @brief Map the bake of a request or decode its image file, catching decoding errors.
+         * @param request The file to decode.
+         * @return The finished decode.
+         */
+        static Result decode(Request request);
+
+        /// Number of pixel unpack buffers used round robin.
+        static constexpr size_t unpackBufferCount = 3;
+
+        mutable std::mutex mutex;
+        std::condition_variable_any queued_cv; ///< Signals workers about new requests.
+        std::condition_variable finished_cv; ///< Signals waiters about finished decodes.
+        std::deque<Request> queue; ///< Requests not yet picked up by a worker.
+        std::vector<std::string> in_flight; ///< Keys currently decoded by a worker.
+        std::deque<Result> finished; ///< Finished decodes not yet taken.
+
+        GLuint unpack_buffers[unpackBufferCount] = {};
+        size_t next_unpack_buffer = 0;
+
+        std::vector<std::jthread> workers; ///< Declared last, so the workers are joined before the queues die.
+    };
+}
@@ -16,6 +16,7 @@ namespace gl3::engine::context
     {
         const auto contextInstance = static_cast<Context*>(glfwGetWindowUserPointer(window));
         glViewport(0, 0, width, height);
+        contextInstance->refreshWindowSize();
         contextInstance->calculateWorldWindowBounds();
     }
 
@@ -71,6 +72,13 @@ namespace gl3::engine::context
         {
             throw std::runtime_error("gl error");
         }
+        // Camera uniform buffer shared by all engine shaders
+        glGenBuffers(1, &frameCameraBuffer);
+        glBindBuffer(GL_UNIFORM_BUFFER, frameCameraBuffer);
+        glBufferData(GL_UNIFORM_BUFFER, sizeof(rendering::FrameCameraBlock), nullptr, GL_DYNAMIC_DRAW);
+        glBindBuffer(GL_UNIFORM_BUFFER, 0);
+        glBindBufferBase(GL_UNIFORM_BUFFER, rendering::frameCameraBindingPoint, frameCameraBuffer);
+        refreshWindowSize();
         calculateWorldWindowBounds();
         ecs::EventDispatcher::dispatcher.sink<ecs::GameExit>().connect<&
             Context::onExitApplication>(this);
@@ -83,6 +91,7 @@ namespace gl3::engine::context
         {
             glClearColor(clearColor.x, clearColor.y, clearColor.z, clearColor.w);
             glClear(GL_COLOR_BUFFER_BIT);
+            updateFrameCamera();
             update(*this);
             glfwPollEvents();
             glfwSwapBuffers(window);
@@ -103,45 +112,65 @@ namespace gl3::engine::context
         calculateWorldWindowBounds();
     }
 
-
-    void Context::calculateWorldWindowBounds()
+    void Context::scrollWindowX(const float distance)
     {
-        int width, height;
-        glfwGetWindowSize(window, &width, &height);
-        if(width <= 0 || height <= 0) return;
+        moveCameraX(distance * pixelsPerMeter);
+    }
 
-        const auto fWidth = static_cast<float>(width);
-        const auto fHeight = static_cast<float>(height);
-        const auto BottomRightScreenCorner = rendering::MVPMatrixHelper::screenToWorld(*this, fWidth, fHeight);
 
+    void Context::refreshWindowSize()
+    {
+        glfwGetWindowSize(window, &windowWidth, &windowHeight);
+    }
+
+    void Context::updateFrameCamera()
+    {
+        if (windowWidth <= 0 || windowHeight <= 0) return;
+
+        const glm::vec2 windowSize = {static_cast<float>(windowWidth), static_cast<float>(windowHeight)};
+        frameCamera.windowSize = windowSize;
+        frameCamera.view = rendering::MVPMatrixHelper::calculateViewMatrix(cameraPosition);
+        frameCamera.projection = rendering::MVPMatrixHelper::calculateProjectionMatrix(windowSize);
+        frameCamera.viewProjection = frameCamera.projection * frameCamera.view;
+        frameCamera.inverseViewProjection = glm::inverse(frameCamera.viewProjection);
+
+        // The bottom right screen corner is (1, -1) in normalized device coordinates
+        const glm::vec4 bottomRight = frameCamera.inverseViewProjection * glm::vec4(1.f, -1.f, 0.f, 1.f);
+        const float windowRightWorld = bottomRight.x / pixelsPerMeter;
+        const float windowBottomWorld = bottomRight.y / pixelsPerMeter;
+        frameCamera.worldBounds = {
+            windowRightWorld - windowSize.x / pixelsPerMeter, windowRightWorld,
+            windowBottomWorld + windowSize.y / pixelsPerMeter, windowBottomWorld
+        };
+
+        const rendering::FrameCameraBlock block{
+            frameCamera.viewProjection, frameCamera.worldBounds,
+            {windowSize.x, windowSize.y, frameCamera.pixelsPerMeter, 0.f}
+        };
+        glBindBuffer(GL_UNIFORM_BUFFER, frameCameraBuffer);
+        glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(block), &block);
+        glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    }
 
-        auto windowLeftWorld = BottomRightScreenCorner.x - fWidth / pixelsPerMeter;
-        auto windowRightWorld = BottomRightScreenCorner.x;
-        auto windowTopWorld = BottomRightScreenCorner.y + fHeight / pixelsPerMeter;
-        auto windowBottomWorld = BottomRightScreenCorner.y;
+    void Context::calculateWorldWindowBounds()
+    {
+        if (windowWidth <= 0 || windowHeight <= 0) return;
 
-        windowBounds = {windowLeftWorld, windowRightWorld, windowTopWorld, windowBottomWorld};
+        updateFrameCamera();
+        const auto& bounds = frameCamera.worldBounds;
+        windowBounds = {bounds.x, bounds.y, bounds.z, bounds.w};
 
         ecs::EventDispatcher::dispatcher.trigger(WindowBoundsRecomputeEvent{
-            width, height, &windowBounds
+            windowWidth, windowHeight, &windowBounds
         });
     }
 
     bool Context::isInVisibleWindow(const glm::vec3& position, const glm::vec3 scale, const float margin) const
     {
-        int width;
-        int height;
-        glfwGetWindowSize(window, &width, &height);
-        const auto fWidth = static_cast<float>(width);
-        const auto fHeight = static_cast<float>(height);
         const auto posLeft = position.x - scale.x * 0.5f;
         const auto posRight = position.x + scale.x * 0.5f;
 
-        const auto worldBottomRightScreenCorner = rendering::MVPMatrixHelper::screenToWorld(*this, fWidth, fHeight);
-        const auto worldScreenWidth = fWidth / pixelsPerMeter;
-
-        return posRight >= worldBottomRightScreenCorner.x - worldScreenWidth - margin && posLeft <=
-            worldBottomRightScreenCorner.x + margin;
+        return posRight >= frameCamera.worldBounds.x - margin && posLeft <= frameCamera.worldBounds.y + margin;
     }
 
     void Context::onExitApplication() const
@@ -155,4 +184,10 @@ namespace gl3::engine::context
             Context::onExitApplication>(this);
         glfwTerminate();
     }
+
+    void Context::releaseGL()
+    {
+        if (frameCameraBuffer) glDeleteBuffers(1, &frameCameraBuffer);
+        frameCameraBuffer = 0;
+    }
 }
@@ -0,0 +1,58 @@
+/**
+* @file FileFingerprint.cpp
+ * @brief Implements hashing and checking source files of derived assets.
+ */
+#include "engine/FileFingerprint.h"
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include "engine/MappedFile.h"
+
+namespace gl3::engine
+{
+    uint64_t FileFingerprint::hashFile(const std::filesystem::path& path)
+    {
+        const MappedFile file(path);
+        return hash(file.bytes());
+    }
+
+    int64_t FileFingerprint::getWriteTime(const std::filesystem::path& path)
+    {
+        std::error_code error;
+        const auto time = std::filesystem::last_write_time(path, error);
+        return error ? 0 : static_cast<int64_t>(time.time_since_epoch().count());
+    }
+
+    bool FileFingerprint::matches(const std::filesystem::path& path, const uint64_t size, const uint64_t sourceHash,
+                                  int64_t& writeTime)
+    {
+        std::error_code error;
+        if (const auto fileSize = std::filesystem::file_size(path, error); error || fileSize != size) return false;
+
+        // Edits can keep the size, only the write time or the content tells
+        const int64_t currentWriteTime = getWriteTime(path);
+        if (currentWriteTime == writeTime) return true;
+        try
+        {
+            if (hashFile(path) != sourceHash) return false;
+        }
+        catch (const std::exception&)
+        {
+            return false;
+        }
+
+        // Touched or copied but unchanged
+        writeTime = currentWriteTime;
+        return true;
+    }
+
+    void FileFingerprint::writeHeader(const std::filesystem::path& path, const std::span<const std::byte> header)
+    {
+        std::fstream stream(path, std::ios::binary | std::ios::in | std::ios::out);
+        stream.write(reinterpret_cast<const char*>(header.data()), static_cast<std::streamsize>(header.size()));
+        if (!stream)
+        {
+            std::cerr << "FileFingerprint: Failed to refresh " << path.string() << std::endl;
+        }
+    }
+}
@@ -1,7 +1,12 @@
 #include <stdexcept>
 #include "engine/Game.h"
+#include "engine/JobSystem.h"
 #include "engine/physics/PhysicsSystem.h"
 #include "engine/rendering/RenderingSystem.h"
+#include "engine/rendering/GLStateCache.h"
+#include "engine/rendering/MeshPool.h"
+#include "engine/rendering/ShaderCache.h"
+#include "engine/rendering/TextureManager.h"
 #include "engine/userInterface/UISystem.h"
 #include "engine/audio/AudioSystem.h"
 #include "engine/levelloading/LevelManager.h"
@@ -13,7 +18,8 @@ namespace gl3::engine
     using Context = context::Context;
 
     Game::Game(const int width, const int height, const std::string& title, const glm::vec3 camPos,
-               const float camZoom): context(width, height, title, camPos, camZoom), physics_world(b2_nullWorldId),
+               const float camZoom, const unsigned physicsWorkers): context(width, height, title, camPos, camZoom),
+                                     job_system(new JobSystem(physicsWorkers)), physics_world(b2_nullWorldId),
                                      physics_system(new physics::PhysicsSystem(*this)),
                                      rendering_system((new rendering::RenderingSystem(*this))),
                                      ui_system(new ui::UISystem(*this)),
@@ -30,6 +36,8 @@ namespace gl3::engine
         b2WorldDef worldDef = b2DefaultWorldDef();
         // We use worldDef to define our physics world
         worldDef.gravity = b2Vec2{0.f, -10.f};
+        // Dense levels spend most of a frame in b2World_Step, spread it over the job system's workers
+        job_system->configureWorld(worldDef);
         physics_world = b2CreateWorld(&worldDef);
         ui_system->initUI();
     }
@@ -40,14 +48,15 @@ namespace gl3::engine
         start();
         //register ui subsystems in time to be able to update them
         registerUiSystems();
-        //preload all textures
-        rendering::TextureManager::loadTextures();
+        //preload all textures in the background, they are uploaded over the next frames
+        rendering::TextureManager::loadTexturesAsync();
         //preload all level metadata files for preview
         levelLoading::LevelManager::loadAllMetaData();
         onAfterStartup.invoke(*this);
         context.run([&](Context& ctx)
         {
             updateDeltaTime();
+            rendering::TextureManager::update();
 
             onBeforeUpdate.invoke(*this);
             update(getWindow());
@@ -72,7 +81,16 @@ namespace gl3::engine
 
     Game::~Game()
     {
+        // Delete cached textures and programs while the GL context still exists
+        rendering::TextureManager::clear();
+        rendering::ShaderCache::clear();
+        rendering::MeshPool::clear();
+        rendering::GLStateCache::releaseSamplers();
+        context.releaseGL();
         glfwTerminate();
+        // The world still points to the job system's callbacks
+        b2DestroyWorld(physics_world);
+        delete job_system;
     }
 
     void Game::updatePhysics()
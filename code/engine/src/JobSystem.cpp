@@ -0,0 +1,180 @@
+/**
+* @file JobSystem.cpp
+ * @brief Implements the work-stealing job system and its Box2D task callbacks.
+ */
+#include "engine/JobSystem.h"
+#include <algorithm>
+
+namespace gl3::engine
+{
+    JobSystem::JobSystem(uint32_t workerCount)
+    {
+        if (workerCount == 0)
+        {
+            workerCount = std::max(1u, std::thread::hardware_concurrency());
+        }
+        workerCount = std::min(workerCount, maxWorkers);
+
+        queues.reserve(workerCount);
+        for (uint32_t i = 0; i < workerCount; ++i)
+        {
+            queues.push_back(std::make_unique<WorkerQueue>());
+        }
+        // Worker 0 is whichever thread waits
+        threads.reserve(workerCount - 1);
+        for (uint32_t i = 1; i < workerCount; ++i)
+        {
+            threads.emplace_back(&JobSystem::workerLoop, this, i);
+        }
+    }
+
+    JobSystem::~JobSystem()
+    {
+        {
+            std::lock_guard lock(sleep_mutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+    void JobSystem::enqueue(TaskGroup& group, TaskFunction* task, const int32_t itemCount, int32_t minRange,
+                            void* context)
+    {
+        if (itemCount <= 0) return;
+
+        minRange = std::max(minRange, 1);
+        // A few ranges per worker leave something to steal when ranges take uneven time
+        const auto maxRanges = static_cast<int32_t>(getWorkerCount() * 4);
+        const int32_t rangeCount = std::clamp(itemCount / minRange, 1, maxRanges);
+        const int32_t rangeSize = itemCount / rangeCount;
+        const int32_t remainder = itemCount % rangeCount;
+
+        group.pending.fetch_add(rangeCount, std::memory_order_relaxed);
+
+        int32_t startIndex = 0;
+        for (int32_t range = 0; range < rangeCount; ++range)
+        {
+            const int32_t endIndex = startIndex + rangeSize + (range < remainder ? 1 : 0);
+            auto& queue = *queues[next_queue];
+            next_queue = (next_queue + 1) % getWorkerCount();
+            {
+                std::lock_guard lock(queue.mutex);
+                queue.jobs.push_back({task, context, startIndex, endIndex, &group});
+            }
+            startIndex = endIndex;
+        }
+
+        queued_jobs.fetch_add(rangeCount, std::memory_order_release);
+        {
+            // Taking the lock orders this with a worker checking queued_jobs right before it sleeps
+            std::lock_guard lock(sleep_mutex);
+        }
+        wake.notify_all();
+    }
+
+    void JobSystem::wait(TaskGroup& group)
+    {
+        while (group.pending.load(std::memory_order_acquire) > 0)
+        {
+            // Ranges of the group may already run on other workers, help with anything left meanwhile
+            if (!runJob(0))
+            {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    void JobSystem::configureWorld(b2WorldDef& worldDef)
+    {
+        worldDef.workerCount = static_cast<int32_t>(getWorkerCount());
+        worldDef.enqueueTask = &JobSystem::enqueueBox2DTask;
+        worldDef.finishTask = &JobSystem::finishBox2DTask;
+        worldDef.userTaskContext = this;
+    }
+
+    bool JobSystem::runJob(const uint32_t workerIndex)
+    {
+        Job job{};
+        bool found = false;
+        {
+            // Newest job of the own queue first, its data is most likely still in cache
+            auto& own = *queues[workerIndex];
+            std::lock_guard lock(own.mutex);
+            if (!own.jobs.empty())
+            {
+                job = own.jobs.back();
+                own.jobs.pop_back();
+                found = true;
+            }
+        }
+        for (uint32_t offset = 1; !found && offset < getWorkerCount(); ++offset)
+        {
+            auto& victim = *queues[(workerIndex + offset) % getWorkerCount()];
+            std::lock_guard lock(victim.mutex);
+            if (!victim.jobs.empty())
+            {
+                job = victim.jobs.front();
+                victim.jobs.pop_front();
+                found = true;
+            }
+        }
+        if (!found) return false;
+
+        queued_jobs.fetch_sub(1, std::memory_order_relaxed);
+        job.task(job.startIndex, job.endIndex, workerIndex, job.context);
+        job.group->pending.fetch_sub(1, std::memory_order_release);
+        return true;
+    }
+
+    void JobSystem::workerLoop(const uint32_t workerIndex)
+    {
+        while (true)
+        {
+            if (runJob(workerIndex)) continue;
+
+            std::unique_lock lock(sleep_mutex);
+            wake.wait(lock, [this] { return stopping || queued_jobs.load(std::memory_order_acquire) > 0; });
+            if (stopping) return;
+        }
+    }
+
+    void* JobSystem::enqueueBox2DTask(b2TaskCallback* task, const int32_t itemCount, const int32_t minRange,
+                                      void* taskContext, void* userContext)
+    {
+        auto* jobs = static_cast<JobSystem*>(userContext);
+        if (jobs->getWorkerCount() == 1)
+        {
+            // Nothing to parallelize, returning nullptr tells Box2D the task already ran
+            task(0, itemCount, 0, taskContext);
+            return nullptr;
+        }
+
+        TaskGroup* group;
+        {
+            std::lock_guard lock(jobs->box2d_mutex);
+            if (jobs->free_box2d_groups.empty())
+            {
+                jobs->box2d_groups.push_back(std::make_unique<TaskGroup>());
+                jobs->free_box2d_groups.push_back(jobs->box2d_groups.back().get());
+            }
+            group = jobs->free_box2d_groups.back();
+            jobs->free_box2d_groups.pop_back();
+        }
+        jobs->enqueue(*group, task, itemCount, minRange, taskContext);
+        return group;
+    }
+
+    void JobSystem::finishBox2DTask(void* userTask, void* userContext)
+    {
+        auto* jobs = static_cast<JobSystem*>(userContext);
+        auto* group = static_cast<TaskGroup*>(userTask);
+        jobs->wait(*group);
+
+        std::lock_guard lock(jobs->box2d_mutex);
+        jobs->free_box2d_groups.push_back(group);
+    }
+}
@@ -0,0 +1,148 @@
+/**
+* @file LevelFile.cpp
+ * @brief Implements reading and writing of JSON and binary level files.
+ */
+#include "engine/levelLoading/LevelFile.h"
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string_view>
+#include <glaze/beve.hpp>
+#include <glaze/json.hpp>
+#include "engine/FileFingerprint.h"
+#include "engine/MappedFile.h"
+#include "engine/levelLoading/CustomSerialization.h"
+
+namespace gl3::engine::levelLoading
+{
+    Level LevelFile::read(const std::filesystem::path& jsonPath)
+    {
+        const auto binaryPath = binaryPathFor(jsonPath);
+        if (LevelFileHeader header; readHeader(binaryPath, header) &&
+            FileFingerprint::isCurrent(jsonPath, binaryPath, header))
+        {
+            try
+            {
+                return readBinary(binaryPath);
+            }
+            catch (const std::exception& e)
+            {
+                std::cerr << e.what() << ", loading the JSON file instead" << std::endl;
+            }
+        }
+        return readJson(jsonPath);
+    }
+
+    Level LevelFile::readJson(const std::filesystem::path& path)
+    {
+        std::ifstream file(path);
+        if (!file)
+        {
+            throw std::runtime_error("Failed to open level file: " + path.string());
+        }
+
+        const std::string json((std::istreambuf_iterator(file)), std::istreambuf_iterator<char>());
+
+        Level level;
+        if (const auto err = glz::read_json(level, json); err)
+        {
+            throw std::runtime_error("Failed to parse level JSON: " + std::to_string(static_cast<int>(err.ec)));
+        }
+        return level;
+    }
+
+    Level LevelFile::readBinary(const std::filesystem::path& path)
+    {
+        const MappedFile file(path);
+        if (file.size() < sizeof(LevelFileHeader))
+        {
+            throw std::runtime_error("LevelFile: " + path.string() + " is too small");
+        }
+        const auto* header = reinterpret_cast<const LevelFileHeader*>(file.data());
+        if (header->magic != LevelFileHeader::expectedMagic || header->version != LevelFileHeader::currentVersion)
+        {
+            throw std::runtime_error("LevelFile: " + path.string() + " is not a binary level of this version");
+        }
+
+        // Parsed in place from the mapping, the file is never copied into a buffer
+        const std::string_view payload(reinterpret_cast<const char*>(file.data() + sizeof(LevelFileHeader)),
+                                       file.size() - sizeof(LevelFileHeader));
+        Level level;
+        if (const auto err = glz::read_beve(level, payload); err)
+        {
+            throw std::runtime_error("LevelFile: Failed to parse " + path.string() + ": " +
+                std::to_string(static_cast<int>(err.ec)));
+        }
+        return level;
+    }
+
+    std::string LevelFile::toJson(const Level& level)
+    {
+        auto result = glz::write_json(level);
+        if (!result)
+        {
+            throw std::runtime_error("Failed to serialize level to JSON");
+        }
+        return std::move(*result);
+    }
+
+    void LevelFile::writeBinary(const Level& level, const uint64_t sourceSize, const uint64_t sourceHash,
+                                const int64_t sourceWriteTime, const std::filesystem::path& path)
+    {
+        const auto payload = glz::write_beve(level);
+        if (!payload)
+        {
+            throw std::runtime_error("LevelFile: Failed to serialize level for " + path.string());
+        }
+
+        LevelFileHeader header;
+        header.sourceSize = sourceSize;
+        header.sourceHash = sourceHash;
+        header.sourceWriteTime = sourceWriteTime;
+
+        if (path.has_parent_path()) std::filesystem::create_directories(path.parent_path());
+        std::ofstream stream(path, std::ios::binary | std::ios::trunc);
+        if (!stream)
+        {
+            throw std::runtime_error("LevelFile: Failed to write " + path.string());
+        }
+        stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        stream.write(payload->data(), static_cast<std::streamsize>(payload->size()));
+        if (!stream)
+        {
+            throw std::runtime_error("LevelFile: Failed to write " + path.string());
+        }
+    }
+
+    void LevelFile::writeJsonAndBinary(const Level& level, const std::filesystem::path& jsonPath)
+    {
+        const std::string json = toJson(level);
+
+        // Binary mode, so the file size matches the size stored in the binary level on every platform
+        std::ofstream file(jsonPath, std::ios::binary | std::ios::trunc);
+        if (!file)
+        {
+            throw std::runtime_error("Failed to open file for writing: " + jsonPath.string());
+        }
+        file << json;
+        file.close();
+
+        const std::span bytes(reinterpret_cast<const std::byte*>(json.data()), json.size());
+        writeBinary(level, json.size(), FileFingerprint::hash(bytes), FileFingerprint::getWriteTime(jsonPath),
+                    binaryPathFor(jsonPath));
+    }
+
+    bool LevelFile::readHeader(const std::filesystem::path& path, LevelFileHeader& header)
+    {
+        std::ifstream stream(path, std::ios::binary);
+        if (!stream) return false;
+        stream.read(reinterpret_cast<char*>(&header), sizeof(header));
+        return stream && header.magic == LevelFileHeader::expectedMagic &&
+            header.version == LevelFileHeader::currentVersion;
+    }
+
+    std::filesystem::path LevelFile::binaryPathFor(const std::filesystem::path& jsonPath)
+    {
+        return std::filesystem::path(jsonPath).replace_extension(binaryExtension);
+    }
+}
@@ -4,6 +4,7 @@
 #include <glaze/json/read.hpp>
 
 #include "engine/Constants.h"
+#include "engine/levelLoading/LevelFile.h"
 
 namespace gl3::engine::levelLoading
 {
@@ -14,9 +15,8 @@ namespace gl3::engine::levelLoading
 
     namespace fs = std::filesystem;
 
-    // Load a single level from a json file in assets/levels, if the level is already loaded, just return it.
-
-    Level* LevelManager::loadLevel(const int ID, const std::string& filename)
+    // Resolves the levelID to a path and returns a pointer to the level, if the level is already loaded, just return it.
+    Level* LevelManager::loadLevelByID(const int ID)
     {
         if (const auto existingLevel = loaded_levels.find(ID); existingLevel != loaded_levels.end())
         {
@@ -24,28 +24,11 @@ namespace gl3::engine::levelLoading
             return existingLevel->second.get();
         }
 
-        const auto path = std::filesystem::path(resolveAssetPath("levels")) / filename;
-        std::ifstream file(path);
-        if (!file)
-        {
-            throw std::runtime_error("Failed to open level file: " + path.string());
-        }
-
-        std::string json((std::istreambuf_iterator(file)), std::istreambuf_iterator<char>());
-
-        auto level = std::make_unique<Level>();
-        if (const auto err = glz::read_json(*level, json); err)
-        {
-            throw std::runtime_error("Failed to parse level JSON: " + std::to_string(static_cast<float>(err.ec)));
-        }
-
-        auto [it, _] = loaded_levels.emplace(ID, std::move(level));
-        most_recent_loaded_lvl_ID = it->first;
-        return it->second.get();
+        return addLoadedLevel(ID, readLevelByID(ID));
     }
 
-    // Resolves the levelID to a path and returns a pointer to the level.
-    Level* LevelManager::loadLevelByID(const int ID)
+    // Read a single level from assets/levels (its .lvlb if up to date, else the json), touches no loaded level.
+    std::unique_ptr<Level> LevelManager::readLevelByID(const int ID)
     {
         const auto levelFileName = idToFilename.find(ID);
         if (levelFileName == idToFilename.end())
@@ -53,7 +36,15 @@ namespace gl3::engine::levelLoading
             throw std::runtime_error("No level filename for id " + std::to_string(ID));
         }
 
-        return loadLevel(levelFileName->first, levelFileName->second);
+        const auto path = std::filesystem::path(resolveAssetPath("levels")) / levelFileName->second;
+        return std::make_unique<Level>(LevelFile::read(path));
+    }
+
+    Level* LevelManager::addLoadedLevel(const int ID, std::unique_ptr<Level> level)
+    {
+        auto [it, _] = loaded_levels.try_emplace(ID, std::move(level));
+        most_recent_loaded_lvl_ID = it->first;
+        return it->second.get();
     }
 
     //Load metadata for all levels from all meda data files in assets/levels folder
@@ -229,12 +220,6 @@ namespace gl3::engine::levelLoading
             roundObjectData(element);
         }
 
-        const auto result = glz::write_json(*level); // returns expected<string, error_ctx>
-        if (!result)
-        {
-            throw std::runtime_error("Failed to serialize level: " + std::to_string(most_recent_loaded_lvl_ID));
-        }
-
         const auto filenameIt = idToFilename.find(most_recent_loaded_lvl_ID);
         if (filenameIt == idToFilename.end())
         {
@@ -243,13 +228,7 @@ namespace gl3::engine::levelLoading
 
         const auto path = std::filesystem::path(resolveAssetPath("levels")) / filenameIt->second;
 
-        std::ofstream file(path);
-        if (!file)
-        {
-            throw std::runtime_error("Failed to open file for writing: " + path.string());
-        }
-
-        file << *result; // Dereference expected to get the string
-        file.close();
+        // Keep the json for editing, the binary version is what gets loaded next time
+        LevelFile::writeJsonAndBinary(*level, path);
     }
 }
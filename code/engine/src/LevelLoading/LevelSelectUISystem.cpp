@@ -199,6 +199,14 @@ namespace gl3::engine::levelLoading
         ImGui::SetCursorPos({(windowSize.x - textSize.x) * 0.5f, windowPos.y + padding.y});
         ImGui::Text("Select a Level");
 
+        // Level textures may still be loading in the background
+        if (rendering::TextureManager::isLoading())
+        {
+            const float barWidth = windowSize.x * 0.3f;
+            ImGui::SetCursorPosX((windowSize.x - barWidth) * 0.5f);
+            ImGui::ProgressBar(rendering::TextureManager::getLoadProgress(), ImVec2(barWidth, 0.f), "Loading...");
+        }
+
         const auto buttonTextSize = ImGui::CalcTextSize("Exit");
         const ImVec2 buttonSize = {buttonTextSize.x + padding.x * 2, buttonTextSize.y + padding.y};
         ImGui::SetCursorPos({(windowSize.x - buttonSize.x) * 0.5f, windowSize.y - buttonSize.y - padding.y * 0.5f});
@@ -0,0 +1,143 @@
+/**
+* @file MappedFile.cpp
+ * @brief Implements read-only file mappings for Windows and POSIX systems.
+ */
+#include "engine/MappedFile.h"
+#include <stdexcept>
+#include <utility>
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace gl3::engine
+{
+#ifdef _WIN32
+    MappedFile::MappedFile(const std::filesystem::path& path)
+    {
+        file_handle = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                  FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file_handle == INVALID_HANDLE_VALUE)
+        {
+            file_handle = nullptr;
+            throw std::runtime_error("MappedFile: Failed to open " + path.string());
+        }
+
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(file_handle, &size))
+        {
+            release();
+            throw std::runtime_error("MappedFile: Failed to get the size of " + path.string());
+        }
+        file_size = static_cast<size_t>(size.QuadPart);
+        // Empty files can't be mapped, they are simply empty
+        if (file_size == 0) return;
+
+        mapping_handle = CreateFileMappingW(file_handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!mapping_handle)
+        {
+            release();
+            throw std::runtime_error("MappedFile: Failed to map " + path.string());
+        }
+        view = static_cast<const std::byte*>(MapViewOfFile(mapping_handle, FILE_MAP_READ, 0, 0, 0));
+        if (!view)
+        {
+            release();
+            throw std::runtime_error("MappedFile: Failed to map a view of " + path.string());
+        }
+    }
+
+    void MappedFile::release()
+    {
+        if (view) UnmapViewOfFile(view);
+        if (mapping_handle) CloseHandle(mapping_handle);
+        if (file_handle) CloseHandle(file_handle);
+        view = nullptr;
+        mapping_handle = nullptr;
+        file_handle = nullptr;
+        file_size = 0;
+    }
+
+    MappedFile::MappedFile(MappedFile&& other) noexcept
+        : view(std::exchange(other.view, nullptr)), file_size(std::exchange(other.file_size, 0)),
+          file_handle(std::exchange(other.file_handle, nullptr)),
+          mapping_handle(std::exchange(other.mapping_handle, nullptr))
+    {
+    }
+
+    MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+    {
+        if (this != &other)
+        {
+            release();
+            view = std::exchange(other.view, nullptr);
+            file_size = std::exchange(other.file_size, 0);
+            file_handle = std::exchange(other.file_handle, nullptr);
+            mapping_handle = std::exchange(other.mapping_handle, nullptr);
+        }
+        return *this;
+    }
+#else
+    MappedFile::MappedFile(const std::filesystem::path& path)
+    {
+        const int descriptor = open(path.c_str(), O_RDONLY);
+        if (descriptor < 0)
+        {
+            throw std::runtime_error("MappedFile: Failed to open " + path.string());
+        }
+
+        struct stat status{};
+        if (fstat(descriptor, &status) != 0)
+        {
+            close(descriptor);
+            throw std::runtime_error("MappedFile: Failed to get the size of " + path.string());
+        }
+        file_size = static_cast<size_t>(status.st_size);
+        if (file_size > 0)
+        {
+            void* mapped = mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+            if (mapped == MAP_FAILED)
+            {
+                close(descriptor);
+                throw std::runtime_error("MappedFile: Failed to map " + path.string());
+            }
+            view = static_cast<const std::byte*>(mapped);
+        }
+        // The mapping stays valid after closing the descriptor
+        close(descriptor);
+    }
+
+    void MappedFile::release()
+    {
+        if (view) munmap(const_cast<std::byte*>(view), file_size);
+        view = nullptr;
+        file_size = 0;
+    }
+
+    MappedFile::MappedFile(MappedFile&& other) noexcept
+        : view(std::exchange(other.view, nullptr)), file_size(std::exchange(other.file_size, 0))
+    {
+    }
+
+    MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+    {
+        if (this != &other)
+        {
+            release();
+            view = std::exchange(other.view, nullptr);
+            file_size = std::exchange(other.file_size, 0);
+        }
+        return *this;
+    }
+#endif
+
+    MappedFile::~MappedFile()
+    {
+        release();
+    }
+}
@@ -1,6 +1,13 @@
 #include "engine/audio/AudioAnalysis.h"
+// The beat tracker and peak picker used by analyzeParallel are only declared for unstable builds
+#define AUBIO_UNSTABLE 1
 #include "../aubio/src/aubio.h"
+#include <algorithm>
+#include <cmath>
 #include <iostream>
+#include <optional>
+#include <span>
+#include "engine/JobSystem.h"
 
 namespace gl3::engine
 {
@@ -56,6 +63,465 @@ namespace gl3::engine
         return bpm;
     }
 
+    namespace
+    {
+        /**
+         * @brief First spectrum bin of each log spaced band, plus the end of the last band.
+         * @param bandCount Number of bands.
+         * @param binCount Number of spectrum bins (bufferSize / 2 + 1).
+         * @return bandCount + 1 strictly increasing bin indices, the DC bin is skipped.
+         */
+        std::vector<unsigned> computeBandEdges(const unsigned bandCount, const unsigned binCount)
+        {
+            std::vector<unsigned> edges(bandCount + 1);
+            const double logEnd = std::log(static_cast<double>(binCount));
+            for (unsigned band = 0; band <= bandCount; ++band)
+            {
+                const auto edge = static_cast<unsigned>(std::lround(std::exp(logEnd * band / bandCount)));
+                // Low bands would be narrower than a bin, give each at least one
+                edges[band] = band == 0 ? 1u : std::max(edge, edges[band - 1] + 1);
+            }
+            for (auto& edge : edges)
+            {
+                edge = std::min(edge, binCount);
+            }
+            return edges;
+        }
+
+        /**
+         * @brief Sums the spectral power of log spaced bands over a sliding Hann window, one row per hop.
+         *
+         * Only needs the power of each bin, so it runs the FFT itself instead of an aubio_pvoc, which would also
+         * compute the square root and phase of every bin.
+         */
+        class BandEnergyTracker
+        {
+        public:
+            BandEnergyTracker(const unsigned bandCount, const unsigned bufferSize, const unsigned hopSize) :
+                bandCount(bandCount), hopSize(hopSize), edges(computeBandEdges(bandCount, bufferSize / 2 + 1)),
+                history(bufferSize), window(new_aubio_window(const_cast<char_t*>("hanningz"), bufferSize)),
+                frame(new_fvec(bufferSize)), compspec(new_fvec(bufferSize)), fft(new_aubio_fft(bufferSize))
+            {
+            }
+
+            ~BandEnergyTracker()
+            {
+                del_aubio_fft(fft);
+                del_fvec(compspec);
+                del_fvec(frame);
+                del_fvec(window);
+            }
+
+            BandEnergyTracker(const BandEnergyTracker&) = delete;
+            BandEnergyTracker& operator=(const BandEnergyTracker&) = delete;
+
+            /**
+             * @brief Slide the window by one hop and compute its band energies.
+             * @param hop The next hopSize samples.
+             * @param row Receives the energy of each band.
+             */
+            void process(const float* hop, const std::span<float> row)
+            {
+                std::copy(history.begin() + hopSize, history.end(), history.begin());
+                std::copy_n(hop, hopSize, history.end() - hopSize);
+                for (size_t i = 0; i < history.size(); ++i)
+                {
+                    frame->data[i] = history[i] * window->data[i];
+                }
+                aubio_fft_do_complex(fft, frame, compspec);
+
+                // compspec is [r0, r1, ..., rN/2, iN/2-1, ..., i1]
+                const unsigned size = compspec->length;
+                for (unsigned band = 0; band < bandCount; ++band)
+                {
+                    float energy = 0.f;
+                    for (unsigned bin = edges[band]; bin < edges[band + 1]; ++bin)
+                    {
+                        const float real = compspec->data[bin];
+                        const float imaginary = bin < size / 2 ? compspec->data[size - bin] : 0.f;
+                        energy += real * real + imaginary * imaginary;
+                    }
+                    row[band] = energy;
+                }
+            }
+
+        private:
+            unsigned bandCount;
+            unsigned hopSize;
+            std::vector<unsigned> edges;
+            std::vector<float> history; ///< Last bufferSize samples, oldest first.
+            fvec_t* window;
+            fvec_t* frame;
+            fvec_t* compspec;
+            aubio_fft_t* fft;
+        };
+
+        /**
+         * @brief A decoded mono track, as whole hops.
+         */
+        struct DecodedAudio
+        {
+            std::vector<float> samples; ///< hopCount * hopSize samples, the last hop is zero padded.
+            unsigned sampleRate = 0;
+        };
+
+        /**
+         * @brief Decode a whole track the same way analyze reads it hop by hop.
+         * @param audioFilePath The path to the audio file.
+         * @param hopSize Samples per hop.
+         * @return The decoded track, std::nullopt if it can't be opened.
+         */
+        std::optional<DecodedAudio> decode(const std::string& audioFilePath, const unsigned hopSize)
+        {
+            aubio_source_t* source = new_aubio_source(audioFilePath.c_str(), 0, hopSize);
+            if (!source) return std::nullopt;
+
+            DecodedAudio decoded;
+            decoded.sampleRate = aubio_source_get_samplerate(source);
+            const uint_t duration = aubio_source_get_duration(source);
+            if (duration > 0) decoded.samples.reserve(duration + hopSize);
+
+            fvec_t* audio_frame = new_fvec(hopSize);
+            uint_t read = 0;
+            while (true)
+            {
+                aubio_source_do(source, audio_frame, &read);
+                if (read == 0) break;
+                decoded.samples.insert(decoded.samples.end(), audio_frame->data, audio_frame->data + hopSize);
+            }
+            del_fvec(audio_frame);
+            del_aubio_source(source);
+            return decoded;
+        }
+
+        /**
+         * @brief The hops a segment of a parallel analysis feeds to its detectors and the hops it keeps.
+         */
+        struct Segment
+        {
+            size_t firstHop; ///< First fed hop, ownBegin minus the warm-up.
+            size_t ownBegin; ///< First kept hop.
+            size_t ownEnd; ///< End of the kept hops.
+            size_t endHop; ///< End of the fed hops, a few hops after ownEnd to catch late onsets.
+        };
+
+        /**
+         * @brief Run the detectors over one segment of a decoded track.
+         * @param audio The decoded track.
+         * @param segment The hops to feed and keep.
+         * @param settings Parameters of the analysis.
+         * @param tempoDetection Receives the tempo detection function of the kept hops, indexed by hop.
+         * @param bandEnergy Receives the band energies of the kept hops, indexed like AnalysisResult::bandEnergy.
+         * @param onsets Receives the onsets inside the kept hops, in seconds.
+         * @return False if the aubio objects can't be created.
+         */
+        bool analyzeSegment(const DecodedAudio& audio, const Segment& segment, const AnalysisSettings& settings,
+                            std::vector<float>& tempoDetection, std::vector<float>& bandEnergy,
+                            std::vector<float>& onsets)
+        {
+            const unsigned hopSize = settings.hopSize;
+            // Same detection function as aubio_tempo_do computes, the peak picking runs over the whole track later
+            aubio_pvoc_t* tempoPvoc = new_aubio_pvoc(settings.bufferSize, hopSize);
+            aubio_specdesc_t* tempoDescriptor = new_aubio_specdesc(settings.tempoMethod == "default"
+                                                                       ? "specflux"
+                                                                       : settings.tempoMethod.c_str(),
+                                                                   settings.bufferSize);
+            aubio_onset_t* onset = new_aubio_onset(settings.onsetMethod.c_str(), settings.bufferSize, hopSize,
+                                                   audio.sampleRate);
+            if (!tempoPvoc || !tempoDescriptor || !onset)
+            {
+                if (tempoPvoc) del_aubio_pvoc(tempoPvoc);
+                if (tempoDescriptor) del_aubio_specdesc(tempoDescriptor);
+                if (onset) del_aubio_onset(onset);
+                return false;
+            }
+            aubio_onset_set_threshold(onset, settings.onsetThreshold);
+            aubio_onset_set_minioi_s(onset, settings.minInterOnsetInterval);
+
+            std::optional<BandEnergyTracker> bands;
+            std::vector<float> warmUpRow(settings.energyBands);
+            if (settings.energyBands > 0) bands.emplace(settings.energyBands, settings.bufferSize, hopSize);
+
+            cvec_t* spectrum = new_cvec(settings.bufferSize);
+            fvec_t* detection = new_fvec(1);
+            fvec_t* audio_frame = new_fvec(hopSize);
+            fvec_t* onset_output = new_fvec(1);
+            const size_t firstSample = segment.firstHop * hopSize;
+            const size_t ownBeginSample = segment.ownBegin * hopSize;
+            const size_t ownEndSample = segment.ownEnd * hopSize;
+
+            for (size_t hop = segment.firstHop; hop < segment.endHop; ++hop)
+            {
+                const float* samples = audio.samples.data() + hop * hopSize;
+                std::copy_n(samples, hopSize, audio_frame->data);
+                const bool owned = hop >= segment.ownBegin && hop < segment.ownEnd;
+
+                aubio_pvoc_do(tempoPvoc, audio_frame, spectrum);
+                aubio_specdesc_do(tempoDescriptor, spectrum, detection);
+                if (owned) tempoDetection[hop] = detection->data[0];
+
+                aubio_onset_do(onset, audio_frame, onset_output);
+                if (fvec_get_sample(onset_output, 0) > 0.0f)
+                {
+                    // The detector reports onsets a few hops late, so they are kept by their time, not by this hop
+                    const size_t sample = firstSample + aubio_onset_get_last(onset);
+                    if (sample >= ownBeginSample && sample < ownEndSample)
+                    {
+                        onsets.push_back(static_cast<float>(sample) / static_cast<float>(audio.sampleRate));
+                    }
+                }
+
+                if (bands && hop < segment.ownEnd)
+                {
+                    // Hops before the segment only fill the window
+                    bands->process(samples, owned
+                                                ? std::span(bandEnergy).subspan(hop * settings.energyBands,
+                                                                                settings.energyBands)
+                                                : std::span(warmUpRow));
+                }
+            }
+
+            del_fvec(onset_output);
+            del_fvec(audio_frame);
+            del_fvec(detection);
+            del_cvec(spectrum);
+            bands.reset();
+            del_aubio_onset(onset);
+            del_aubio_specdesc(tempoDescriptor);
+            del_aubio_pvoc(tempoPvoc);
+            return true;
+        }
+
+        /**
+         * @brief Peak picking and beat tracking of aubio_tempo_do, over the detection function of a whole track.
+         * @param audio The decoded track, for the silence test of each beat.
+         * @param tempoDetection The tempo detection function, one value per hop.
+         * @param settings Parameters of the analysis.
+         * @param result Receives bpm and beats.
+         */
+        void trackBeats(const DecodedAudio& audio, const std::vector<float>& tempoDetection,
+                        const AnalysisSettings& settings, AnalysisResult& result)
+        {
+            const unsigned hopSize = settings.hopSize;
+            // Observations of about 6 seconds, like new_aubio_tempo
+            const uint_t winlen = std::max<uint_t>(
+                aubio_next_power_of_two(static_cast<uint_t>(5.8 * audio.sampleRate / hopSize)), 4);
+            const uint_t step = winlen / 4;
+            constexpr float silence = -90.f;
+
+            aubio_beattracking_t* beatTracking = new_aubio_beattracking(winlen, hopSize, audio.sampleRate);
+            aubio_peakpicker_t* peakPicker = new_aubio_peakpicker();
+            aubio_peakpicker_set_threshold(peakPicker, settings.tempoThreshold);
+            fvec_t* dfframe = new_fvec(winlen);
+            fvec_t* out = new_fvec(step);
+            fvec_t* detection = new_fvec(1);
+            fvec_t* peak = new_fvec(1);
+            fvec_t* audio_frame = new_fvec(hopSize);
+
+            int blockpos = 0;
+            uint_t totalFrames = 0;
+            for (size_t hop = 0; hop < tempoDetection.size(); ++hop)
+            {
+                detection->data[0] = tempoDetection[hop];
+                if (blockpos == static_cast<int>(step) - 1)
+                {
+                    aubio_beattracking_do(beatTracking, dfframe, out);
+                    std::copy(dfframe->data + step, dfframe->data + winlen, dfframe->data);
+                    std::fill(dfframe->data + winlen - step, dfframe->data + winlen, 0.f);
+                    blockpos = -1;
+                }
+                ++blockpos;
+                aubio_peakpicker_do(peakPicker, detection, peak);
+                dfframe->data[winlen - step + blockpos] = aubio_peakpicker_get_thresholded_input(peakPicker)->data[0];
+
+                float beat = 0.f;
+                uint_t lastBeat = 0;
+                for (uint_t i = 1; i < out->data[0]; ++i)
+                {
+                    if (blockpos == std::floor(out->data[i]))
+                    {
+                        beat = out->data[i] - std::floor(out->data[i]);
+                        std::copy_n(audio.samples.data() + hop * hopSize, hopSize, audio_frame->data);
+                        if (aubio_silence_detection(audio_frame, silence) == 1) beat = 0.f;
+                        lastBeat = totalFrames + static_cast<uint_t>(std::floor(beat * hopSize + .5));
+                    }
+                }
+                if (beat > 0.f)
+                {
+                    result.beats.push_back(static_cast<float>(lastBeat) / static_cast<float>(audio.sampleRate));
+                }
+                totalFrames += hopSize;
+            }
+            result.bpm = aubio_beattracking_get_bpm(beatTracking);
+
+            del_fvec(audio_frame);
+            del_fvec(peak);
+            del_fvec(detection);
+            del_fvec(out);
+            del_fvec(dfframe);
+            del_aubio_peakpicker(peakPicker);
+            del_aubio_beattracking(beatTracking);
+        }
+    }
+
+    AnalysisResult AudioAnalysis::analyze(const std::string& audioFilePath, const AnalysisSettings& settings,
+                                          JobSystem* jobSystem)
+    {
+        if (jobSystem)
+        {
+            return analyzeParallel(audioFilePath, settings, *jobSystem);
+        }
+
+        AnalysisResult result;
+        //aubio detects sampleRate automatically if 0
+        unsigned int sampleRate = 0;
+        aubio_source_t* source = new_aubio_source(audioFilePath.c_str(), sampleRate, settings.hopSize);
+        if (!source)
+        {
+            std::cerr << "Error: Failed to open audio source!" << std::endl;
+            return result;
+        }
+        sampleRate = aubio_source_get_samplerate(source);
+
+        aubio_tempo_t* tempo = new_aubio_tempo(settings.tempoMethod.c_str(), settings.bufferSize, settings.hopSize,
+                                               sampleRate);
+        aubio_onset_t* onset = new_aubio_onset(settings.onsetMethod.c_str(), settings.bufferSize, settings.hopSize,
+                                               sampleRate);
+        if (!tempo || !onset)
+        {
+            std::cerr << "Error: Failed to create tempo or onset object!" << std::endl;
+            if (tempo) del_aubio_tempo(tempo);
+            if (onset) del_aubio_onset(onset);
+            del_aubio_source(source);
+            return result;
+        }
+        aubio_tempo_set_threshold(tempo, settings.tempoThreshold);
+        aubio_onset_set_threshold(onset, settings.onsetThreshold);
+        aubio_onset_set_minioi_s(onset, settings.minInterOnsetInterval);
+
+        // Band energies need their own spectrum, tempo and onset keep their phase vocoders internal
+        std::optional<BandEnergyTracker> bands;
+        if (settings.energyBands > 0)
+        {
+            bands.emplace(settings.energyBands, settings.bufferSize, settings.hopSize);
+            result.energyBands = settings.energyBands;
+            result.frameDuration = static_cast<float>(settings.hopSize) / static_cast<float>(sampleRate);
+        }
+
+        fvec_t* audio_frame = new_fvec(settings.hopSize);
+        fvec_t* beat_output = new_fvec(1);
+        fvec_t* onset_output = new_fvec(1);
+
+        uint_t read = 0;
+        while (true)
+        {
+            aubio_source_do(source, audio_frame, &read);
+            if (read == 0) break;
+
+            aubio_tempo_do(tempo, audio_frame, beat_output);
+            if (fvec_get_sample(beat_output, 0) > 0.0f)
+            {
+                result.beats.push_back(aubio_tempo_get_last_s(tempo));
+            }
+
+            aubio_onset_do(onset, audio_frame, onset_output);
+            if (fvec_get_sample(onset_output, 0) > 0.0f)
+            {
+                result.onsets.push_back(aubio_onset_get_last_s(onset));
+            }
+
+            if (bands)
+            {
+                result.bandEnergy.resize(result.bandEnergy.size() + settings.energyBands);
+                bands->process(audio_frame->data, std::span(result.bandEnergy).last(settings.energyBands));
+            }
+        }
+        result.bpm = aubio_tempo_get_bpm(tempo);
+
+        del_fvec(onset_output);
+        del_fvec(beat_output);
+        del_fvec(audio_frame);
+        bands.reset();
+        del_aubio_onset(onset);
+        del_aubio_tempo(tempo);
+        del_aubio_source(source);
+        aubio_cleanup();
+
+        return result;
+    }
+
+    AnalysisResult AudioAnalysis::analyzeParallel(const std::string& audioFilePath, const AnalysisSettings& settings,
+                                                  JobSystem& jobSystem)
+    {
+        AnalysisResult result;
+        const auto audio = decode(audioFilePath, settings.hopSize);
+        if (!audio)
+        {
+            std::cerr << "Error: Failed to open audio source!" << std::endl;
+            return result;
+        }
+
+        const size_t hopCount = audio->samples.size() / settings.hopSize;
+        const double hopsPerSecond = static_cast<double>(audio->sampleRate) / settings.hopSize;
+        const size_t segmentHops = std::max<size_t>(1, std::lround(settings.segmentSeconds * hopsPerSecond));
+        // Enough to fill the phase vocoder's window and the two frames of history the descriptors keep
+        const size_t minOverlapHops = (settings.bufferSize + settings.hopSize - 1) / settings.hopSize + 2;
+        const size_t overlapHops = std::max<size_t>(minOverlapHops,
+                                                    std::lround(settings.segmentOverlapSeconds * hopsPerSecond));
+        // The onset detector reports onsets about 5 hops late and its peak picker looks 5 hops ahead
+        const size_t tailHops = minOverlapHops + 10;
+        const size_t segmentCount = (hopCount + segmentHops - 1) / segmentHops;
+
+        std::vector<float> tempoDetection(hopCount);
+        if (settings.energyBands > 0)
+        {
+            result.energyBands = settings.energyBands;
+            result.frameDuration = static_cast<float>(settings.hopSize) / static_cast<float>(audio->sampleRate);
+            result.bandEnergy.resize(hopCount * settings.energyBands);
+        }
+        // Segments only write their own hops and onsets, so the merged result doesn't depend on the scheduling
+        std::vector<std::vector<float>> segmentOnsets(segmentCount);
+        std::vector<char> segmentFailed(segmentCount, 0);
+
+        jobSystem.parallelFor(static_cast<int32_t>(segmentCount), 1,
+                              [&](const int32_t startIndex, const int32_t endIndex, uint32_t)
+                              {
+                                  for (int32_t index = startIndex; index < endIndex; ++index)
+                                  {
+                                      Segment segment;
+                                      segment.ownBegin = index * segmentHops;
+                                      segment.ownEnd = std::min(hopCount, segment.ownBegin + segmentHops);
+                                      segment.firstHop = segment.ownBegin - std::min(segment.ownBegin, overlapHops);
+                                      segment.endHop = std::min(hopCount, segment.ownEnd + tailHops);
+                                      segmentFailed[index] = !analyzeSegment(*audio, segment, settings,
+                                                                             tempoDetection, result.bandEnergy,
+                                                                             segmentOnsets[index]);
+                                  }
+                              });
+        if (std::ranges::find(segmentFailed, 1) != segmentFailed.end())
+        {
+            std::cerr << "Error: Failed to create tempo or onset object!" << std::endl;
+            aubio_cleanup();
+            return {};
+        }
+
+        for (const auto& onsets : segmentOnsets)
+        {
+            auto onset = onsets.begin();
+            // Both sides of a seam can report the same transient
+            while (onset != onsets.end() && !result.onsets.empty() &&
+                *onset - result.onsets.back() < settings.minInterOnsetInterval)
+            {
+                ++onset;
+            }
+            result.onsets.insert(result.onsets.end(), onset, onsets.end());
+        }
+
+        trackBeats(*audio, tempoDetection, settings, result);
+        aubio_cleanup();
+        return result;
+    }
+
     std::vector<float> AudioAnalysis::analyzeAudioOnsets(
         const std::string& audioFilePath,
         const unsigned int hopSize,
@@ -0,0 +1,141 @@
+/**
+* @file AudioAnalysisCache.cpp
+ * @brief Implements the on-disk cache of audio analysis results.
+ */
+#include "engine/audio/AudioAnalysisCache.h"
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include "engine/FileFingerprint.h"
+
+namespace gl3::engine
+{
+    namespace
+    {
+        /**
+         * @brief Write a header and the result's arrays.
+         * @throws std::runtime_error If the file can't be written.
+         */
+        void writeSidecar(const AudioAnalysisCacheHeader& header, const AnalysisResult& result,
+                          const std::filesystem::path& path)
+        {
+            if (path.has_parent_path()) std::filesystem::create_directories(path.parent_path());
+            std::ofstream stream(path, std::ios::binary | std::ios::trunc);
+            if (!stream)
+            {
+                throw std::runtime_error("AudioAnalysisCache: Failed to write " + path.string());
+            }
+            stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            stream.write(reinterpret_cast<const char*>(result.beats.data()),
+                         static_cast<std::streamsize>(result.beats.size() * sizeof(float)));
+            stream.write(reinterpret_cast<const char*>(result.onsets.data()),
+                         static_cast<std::streamsize>(result.onsets.size() * sizeof(float)));
+            stream.write(reinterpret_cast<const char*>(result.bandEnergy.data()),
+                         static_cast<std::streamsize>(result.bandEnergy.size() * sizeof(float)));
+            if (!stream)
+            {
+                throw std::runtime_error("AudioAnalysisCache: Failed to write " + path.string());
+            }
+        }
+    }
+
+    AnalysisResult AudioAnalysisCache::getOrAnalyze(const std::filesystem::path& audioPath,
+                                                    const AnalysisSettings& settings, JobSystem* jobSystem)
+    {
+        const auto cachePath = cachePathFor(audioPath);
+        if (auto cached = load(audioPath, cachePath, settings))
+        {
+            return std::move(*cached);
+        }
+
+        auto result = AudioAnalysis::analyze(audioPath.string(), settings, jobSystem);
+        try
+        {
+            store(audioPath, cachePath, settings, result);
+        }
+        catch (const std::exception& e)
+        {
+            // Read-only asset folders just don't get a cache
+            std::cerr << e.what() << std::endl;
+        }
+        return result;
+    }
+
+    std::optional<AnalysisResult> AudioAnalysisCache::load(const std::filesystem::path& audioPath,
+                                                           const std::filesystem::path& cachePath,
+                                                           const AnalysisSettings& settings)
+    {
+        std::ifstream stream(cachePath, std::ios::binary);
+        if (!stream) return std::nullopt;
+
+        AudioAnalysisCacheHeader header;
+        stream.read(reinterpret_cast<char*>(&header), sizeof(header));
+        if (!stream || header.magic != AudioAnalysisCacheHeader::expectedMagic ||
+            header.version != AudioAnalysisCacheHeader::currentVersion ||
+            header.settingsHash != hashSettings(settings) || !FileFingerprint::isCurrent(audioPath, cachePath, header))
+        {
+            return std::nullopt;
+        }
+
+        AnalysisResult result;
+        result.bpm = header.bpm;
+        result.beats.resize(header.beatCount);
+        result.onsets.resize(header.onsetCount);
+        result.energyBands = header.energyBands;
+        result.frameDuration = header.frameDuration;
+        result.bandEnergy.resize(static_cast<size_t>(header.bandFrameCount) * header.energyBands);
+        stream.read(reinterpret_cast<char*>(result.beats.data()),
+                    static_cast<std::streamsize>(result.beats.size() * sizeof(float)));
+        stream.read(reinterpret_cast<char*>(result.onsets.data()),
+                    static_cast<std::streamsize>(result.onsets.size() * sizeof(float)));
+        stream.read(reinterpret_cast<char*>(result.bandEnergy.data()),
+                    static_cast<std::streamsize>(result.bandEnergy.size() * sizeof(float)));
+        if (!stream) return std::nullopt;
+        return result;
+    }
+
+    void AudioAnalysisCache::store(const std::filesystem::path& audioPath, const std::filesystem::path& cachePath,
+                                   const AnalysisSettings& settings, const AnalysisResult& result)
+    {
+        AudioAnalysisCacheHeader header;
+        header.settingsHash = hashSettings(settings);
+        header.sourceHash = FileFingerprint::hashFile(audioPath);
+        header.sourceSize = std::filesystem::file_size(audioPath);
+        header.sourceWriteTime = FileFingerprint::getWriteTime(audioPath);
+        header.bpm = result.bpm;
+        header.beatCount = static_cast<uint32_t>(result.beats.size());
+        header.onsetCount = static_cast<uint32_t>(result.onsets.size());
+        header.energyBands = result.energyBands;
+        header.bandFrameCount = static_cast<uint32_t>(result.getFrameCount());
+        header.frameDuration = result.frameDuration;
+        writeSidecar(header, result, cachePath);
+    }
+
+    std::filesystem::path AudioAnalysisCache::cachePathFor(const std::filesystem::path& audioPath)
+    {
+        return std::filesystem::path(audioPath).concat(extension);
+    }
+
+    uint64_t AudioAnalysisCache::hashSettings(const AnalysisSettings& settings)
+    {
+        const auto hashValue = [](const auto& value, const uint64_t seed)
+        {
+            return FileFingerprint::hash(std::as_bytes(std::span(&value, 1)), seed);
+        };
+        const auto hashString = [](const std::string& text, const uint64_t seed)
+        {
+            // Include the terminator, so "ab" + "c" and "a" + "bc" differ
+            return FileFingerprint::hash(std::as_bytes(std::span(text.c_str(), text.size() + 1)), seed);
+        };
+
+        uint64_t hashed = hashValue(settings.hopSize, FileFingerprint::hashSeed);
+        hashed = hashValue(settings.bufferSize, hashed);
+        hashed = hashString(settings.tempoMethod, hashed);
+        hashed = hashValue(settings.tempoThreshold, hashed);
+        hashed = hashString(settings.onsetMethod, hashed);
+        hashed = hashValue(settings.onsetThreshold, hashed);
+        hashed = hashValue(settings.minInterOnsetInterval, hashed);
+        // Segmentation is left out, a parallel analysis matches the serial one within its tolerance
+        return hashValue(settings.energyBands, hashed);
+    }
+}
@@ -1,15 +1,18 @@
 #include "engine/audio/AudioSystem.h"
 
+#include <cstdio>
 #include <iostream>
 
 #include "engine/audio/AudioAnalysis.h"
+#include "engine/audio/AudioAnalysisCache.h"
 #include "engine/Assets.h"
+#include "engine/JobSystem.h"
 #include "engine/ecs/EventDispatcher.h"
 #include "engine/ecs/GameEvents.h"
 
 namespace gl3::engine::audio
 {
-    AudioSystem::AudioSystem(Game& game) : System(game)
+    AudioSystem::AudioSystem(Game& game) : System(game), analysis_jobs(std::make_unique<JobSystem>())
     {
         ecs::EventDispatcher::dispatcher.sink<ui::VolumeChangeEvent>().connect<&
             AudioSystem::onGlobalVolumeChanged>(this);
@@ -94,19 +97,58 @@ namespace gl3::engine::audio
 
     void AudioSystem::initializeCurrentAudio(const std::string& fileName, const float positionOffsetX)
     {
-        const auto path = "audio/" + fileName;
         if (!config)
         {
             config = std::make_unique<AudioConfig>();
             config->audio.init();
         }
-        config->backgroundMusic = std::make_unique<SoLoud::Wav>();
-        config->backgroundMusic->load(resolveAssetPath(path).c_str());
-        config->backgroundMusic->setLooping(false);
-        config->current_audio_length = static_cast<float>(config->backgroundMusic->getLength());
+        setCurrentAudio(loadAudio(fileName, config->hopSize, config->bufferSize, config->readAheadBytes,
+                                  analysis_jobs.get()), positionOffsetX);
+    }
+
+    LoadedAudio AudioSystem::loadAudio(const std::string& fileName, const unsigned hopSize, const unsigned bufferSize,
+                                       const unsigned readAheadBytes, JobSystem* analysisJobs)
+    {
+        LoadedAudio loaded;
+        loaded.filePath = resolveAssetPath("audio/" + fileName);
+        loaded.music = std::make_unique<SoLoud::WavStream>();
+        if (FILE* handle = std::fopen(loaded.filePath.c_str(), "rb"))
+        {
+            // The mixer reads the stream in small blocks, the stdio buffer turns them into fewer, larger disk reads
+            std::setvbuf(handle, nullptr, readAheadBytes > 0 ? _IOFBF : _IONBF, readAheadBytes);
+            loaded.file = std::make_unique<SoLoud::DiskFile>(handle);
+            if (loaded.music->loadFile(loaded.file.get()) != SoLoud::SO_NO_ERROR)
+            {
+                std::cerr << "[AudioSystem] Failed to stream audio: " << fileName << std::endl;
+            }
+        }
+        else
+        {
+            std::cerr << "[AudioSystem] Failed to open audio: " << fileName << std::endl;
+        }
+        loaded.music->setLooping(false);
+        loaded.length = static_cast<float>(loaded.music->getLength());
+        AnalysisSettings settings;
+        settings.hopSize = hopSize;
+        settings.bufferSize = bufferSize;
+        // Only analyzed the first time a track is loaded, afterwards it comes from the sidecar
+        loaded.bpm = AudioAnalysisCache::getOrAnalyze(loaded.filePath, settings, analysisJobs).bpm;
+        return loaded;
+    }
 
-        const std::string audio_file = resolveAssetPath(path);
-        config->bpm = AudioAnalysis::analyzeAudioTempo(audio_file, config->hopSize, config->bufferSize);
+    void AudioSystem::setCurrentAudio(LoadedAudio loaded, const float positionOffsetX)
+    {
+        if (!config)
+        {
+            config = std::make_unique<AudioConfig>();
+            config->audio.init();
+        }
+        // The old music stops before the file it streams from is closed
+        config->backgroundMusic = std::move(loaded.music);
+        config->backgroundFile = std::move(loaded.file);
+        config->filePath = std::move(loaded.filePath);
+        config->current_audio_length = loaded.length;
+        config->bpm = loaded.bpm;
         config->seconds_per_beat = 60 / config->bpm;
         config->beatPositions = AudioAnalysis::generateBeatTimestamps(
             config->current_audio_length,
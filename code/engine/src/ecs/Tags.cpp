@@ -0,0 +1,29 @@
+/**
+* @file Tags.cpp
+ * @brief Implements interning of tag strings.
+ */
+#include "engine/ecs/Tags.h"
+#include <stdexcept>
+
+namespace gl3::engine::ecs
+{
+    std::unordered_map<TagId, std::string> TagRegistry::names;
+
+    TagId TagRegistry::intern(const std::string_view tag)
+    {
+        const TagId id = hashTag(tag);
+        if (const auto [name, inserted] = names.try_emplace(id, tag); !inserted && name->second != tag)
+        {
+            throw std::runtime_error("TagRegistry: Tags '" + name->second + "' and '" + std::string(tag) +
+                "' have the same id, rename one of them");
+        }
+        return id;
+    }
+
+    const std::string& TagRegistry::getName(const TagId id)
+    {
+        static const std::string undefined = "undefined";
+        const auto name = names.find(id);
+        return name != names.end() ? name->second : undefined;
+    }
+}
@@ -59,27 +59,26 @@ namespace gl3::engine::editor
             };
 
             // Create a shape for this child tile
-            const b2ShapeDef shapeDef = b2DefaultShapeDef();
-            const b2Polygon polygon = b2MakeOffsetBox(
-                event.object.scale.x * 0.5f,
-                event.object.scale.y * 0.5f,
-                {localOffset.x, localOffset.y},
-                b2MakeRot(event.object.zRotation)
-            );
-            b2ShapeId shapeId = b2CreatePolygonShape(current_parent_body_id, &shapeDef, &polygon);
+            const b2ShapeId shapeId = ecs::EntityFactory::createGroupChildShape(
+                current_parent_body_id, entity, reg.get<ecs::TagComponent>(entity).id, localOffset,
+                event.object.scale, event.object.zRotation);
 
             // Attach ECS PhysicsGroup linking child to parent
             reg.emplace<ecs::PhysicsGroupChild>(entity, current_parent_entity, localOffset, shapeId);
 
-            // Increment the parent’s child count
-            reg.patch<ecs::PhysicsGroupParent>(current_parent_entity, [](auto& pgp) { ++pgp.childCount;  ++pgp.visibleChildren;});
+            // Register the child with its parent
+            reg.patch<ecs::PhysicsGroupParent>(current_parent_entity, [entity](auto& pgp)
+            {
+                pgp.children.push_back(entity);
+                ++pgp.childCount;
+                ++pgp.visibleChildren;
+            });
             current_group.children.push_back(event.object);
         }
         else
         {
             levelLoading::LevelManager::addObjectToCurrentLevel(event.object);
         }
-        ecs::EventDispatcher::dispatcher.trigger(ecs::RenderComponentContainerChange{});
     }
 
 
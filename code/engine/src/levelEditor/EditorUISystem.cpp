@@ -15,7 +15,7 @@ namespace gl3::engine::editor
     void EditorUISystem::onMouseScroll(const context::MouseScrollEvent& event) const
     {
         if (!is_active || !game.isPaused() || !is_mouse_in_grid) return;
-        game.getContext().moveCameraX(static_cast<float>(event.yOffset * 50.0f));
+        game.getContext().moveCameraX(static_cast<float>(event.yOffset * 100.0f));
     }
 
 
@@ -29,14 +29,13 @@ namespace gl3::engine::editor
     void EditorUISystem::deleteAllAtSelectedCell() const
     {
         auto& registry = game.getRegistry();
-        const auto& view = registry.view<ecs::TransformComponent, ecs::TagComponent>();
+        //Don't destroy backgrounds or Physics Parents in Editor
+        const auto& view = registry.view<ecs::TransformComponent, ecs::TagComponent>(
+            entt::exclude<ecs::BackdropTag, ecs::PhysicsGroupParent>);
         if (selected_grid_cells.empty()) return;
         for (auto& entity : view)
         {
             const auto transform = view.get<ecs::TransformComponent>(entity);
-            const auto tag = view.get<ecs::TagComponent>(entity).tag;
-            //Don't destroy backgrounds or Physics Parents in Editor
-            if (tag == "background" || tag == "ground" || tag == "sky" || registry.any_of<ecs::PhysicsGroupParent>(entity)) continue;
 
             for (const auto& cell : selected_grid_cells)
             {
@@ -56,6 +55,7 @@ namespace gl3::engine::editor
                         if (registry.valid(parentEntity) && registry.any_of<ecs::PhysicsGroupParent>(parentEntity))
                         {
                             auto& parent = registry.get<ecs::PhysicsGroupParent>(parentEntity);
+                            std::erase(parent.children, entity);
                             --parent.childCount;
                             --parent.visibleChildren;
 
@@ -219,11 +219,11 @@ namespace gl3::engine::editor
         }
     }
 
-    void EditorUISystem::visualizeTileSetUI(const rendering::Texture& texture, const std::string& name,
+    void EditorUISystem::visualizeTileSetUI(const rendering::TextureRegion& texture, const std::string& name,
                                             const float tileSize)
     {
         ImGui::Text(name.c_str());
-        const auto& uvs = texture.getTileUVs();
+        const auto& uvs = texture.tileUVs;
 
         for (int i = 0; i < uvs.size(); ++i)
         {
@@ -232,15 +232,17 @@ namespace gl3::engine::editor
             const auto& uv = uvs[i];
 
             std::string buttonId = name + "_Tile_" + std::to_string(i);
-            ImVec2 uv0(uv.x, uv.w);
-            ImVec2 uv1(uv.z, uv.y);
+            // The level keeps the tile uvs local to the tileset, only the preview needs them in atlas space
+            const auto atlasUV = texture.toTextureUV(uv);
+            ImVec2 uv0(atlasUV.x, atlasUV.w);
+            ImVec2 uv1(atlasUV.z, atlasUV.y);
 
             ImGui::PushStyleVar(ImGuiStyleVar_FrameRounding, 1.0f);
             ImGui::PushStyleColor(ImGuiCol_Button, UINeonColors::pastelNeonViolet);
             ImGui::PushStyleColor(ImGuiCol_ButtonHovered, UINeonColors::pastelNeonViolet2);
             ImGui::PushStyleColor(ImGuiCol_ButtonActive, UINeonColors::Cyan);
 
-            if (ImGui::ImageButton(buttonId.c_str(), texture.getID(),
+            if (ImGui::ImageButton(buttonId.c_str(), texture.texture->getID(),
                                    ImVec2(tileSize, tileSize), uv0, uv1) && !selected_grid_cells.empty())
             {
                 for (const auto& cell : selected_grid_cells)
@@ -275,15 +277,17 @@ namespace gl3::engine::editor
         ImGui::Separator();
     }
 
-    void EditorUISystem::visualizeSingleTextureUI(const rendering::Texture& texture, const std::string& name,
+    void EditorUISystem::visualizeSingleTextureUI(const rendering::TextureRegion& texture, const std::string& name,
                                                   const float tileSize)
     {
         const std::string btnID = name + "_full";
         ImGui::PushStyleColor(ImGuiCol_Button, UINeonColors::pastelNeonViolet); // normal
         ImGui::PushStyleColor(ImGuiCol_ButtonHovered, UINeonColors::pastelNeonViolet2); // hovered
         ImGui::PushStyleColor(ImGuiCol_ButtonActive, UINeonColors::Cyan);
-        if (ImGui::ImageButton(btnID.c_str(), texture.getID(),
-                               ImVec2(tileSize, tileSize), ImVec2(0, 0), ImVec2(1, -1))
+        // Flip vertically, textures are stored bottom to top
+        if (ImGui::ImageButton(btnID.c_str(), texture.texture->getID(),
+                               ImVec2(tileSize, tileSize), ImVec2(texture.rect.x, texture.rect.w),
+                               ImVec2(texture.rect.z, texture.rect.y))
             && !selected_grid_cells.empty())
         {
             for (const auto& cell : selected_grid_cells)
@@ -665,14 +669,14 @@ namespace gl3::engine::editor
             {
                 if (tileIndex % tilesPerRow != 0)
                     ImGui::SameLine();
-                visualizeSingleTextureUI(*texture, name, tileSize);
+                visualizeSingleTextureUI(texture, name, tileSize);
                 tileIndex++;
             }
             ImGui::Separator();
 
             for (const auto& [name, texture] : rendering::TextureManager::getAllTileSets())
             {
-                visualizeTileSetUI(*texture, name, tileSize);
+                visualizeTileSetUI(texture, name, tileSize);
             }
         }
 
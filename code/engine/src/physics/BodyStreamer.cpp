@@ -0,0 +1,191 @@
+/**
+* @file BodyStreamer.cpp
+ * @brief Implements creating and recycling Box2D bodies around the camera.
+ */
+#include "engine/physics/BodyStreamer.h"
+#include <algorithm>
+#include <cmath>
+
+namespace gl3::engine::physics
+{
+    BodyStreamer::BodyStreamer(const float lookAhead, const float lookBehind) : look_ahead(lookAhead),
+        look_behind(lookBehind)
+    {
+    }
+
+    void BodyStreamer::setDistances(const float lookAhead, const float lookBehind)
+    {
+        look_ahead = std::max(0.f, lookAhead);
+        look_behind = std::max(0.f, lookBehind);
+    }
+
+    void BodyStreamer::add(entt::registry& registry, const entt::entity entity, const GameObject& object)
+    {
+        const float halfWidth = object.scale.x * 0.5f;
+        auto& streamed = registry.emplace_or_replace<StreamedBodyComponent>(entity);
+        streamed.object = object;
+        streamed.minX = object.position.x - halfWidth;
+        streamed.maxX = object.position.x + halfWidth;
+
+        entries.push_back({streamed.minX, entity});
+        sorted = false;
+    }
+
+    void BodyStreamer::addChild(entt::registry& registry, const entt::entity parent, const entt::entity child)
+    {
+        auto& streamed = registry.get<StreamedBodyComponent>(parent);
+        const auto& initial = registry.get<ecs::InitialTransformComponent>(child);
+        const float halfWidth = std::abs(initial.scale.x) * 0.5f;
+        streamed.children.push_back(child);
+        streamed.minX = std::min(streamed.minX, initial.position.x - halfWidth);
+        streamed.maxX = std::max(streamed.maxX, initial.position.x + halfWidth);
+        // The entry picks up the widened extent when sorting
+        sorted = false;
+    }
+
+    void BodyStreamer::update(entt::registry& registry, const b2WorldId physicsWorld, const float windowLeft,
+                              const float windowRight)
+    {
+        if (entries.empty()) return;
+
+        const float spawnRight = windowRight + look_ahead;
+        const float despawnLeft = windowLeft - look_behind;
+
+        if (!sorted)
+        {
+            for (auto& [minX, entity] : entries)
+            {
+                if (const auto* streamed = registry.valid(entity)
+                                               ? registry.try_get<StreamedBodyComponent>(entity)
+                                               : nullptr)
+                {
+                    minX = streamed->minX;
+                }
+            }
+            std::ranges::sort(entries, {}, &Entry::minX);
+            sorted = true;
+            next_entry = 0;
+        }
+        if (windowLeft < last_window_left)
+        {
+            // Jumped back (restart, editor scrolling), entities behind the window may be needed again
+            next_entry = 0;
+        }
+        last_window_left = windowLeft;
+
+        // Free bodies that passed behind the window, or are far ahead of it after jumping back
+        for (size_t i = 0; i < spawned.size();)
+        {
+            const entt::entity entity = spawned[i];
+            const auto* streamed = registry.valid(entity) ? registry.try_get<StreamedBodyComponent>(entity) : nullptr;
+            if (streamed && streamed->maxX >= despawnLeft && streamed->minX <= spawnRight + look_ahead)
+            {
+                ++i;
+                continue;
+            }
+            if (streamed) despawn(registry, entity);
+            spawned[i] = spawned.back();
+            spawned.pop_back();
+        }
+
+        // Entries are sorted by their left edge, so only the ones the right edge reached since the last frame are new
+        for (; next_entry < entries.size() && entries[next_entry].minX <= spawnRight; ++next_entry)
+        {
+            const entt::entity entity = entries[next_entry].entity;
+            if (!registry.valid(entity)) continue;
+
+            auto* streamed = registry.try_get<StreamedBodyComponent>(entity);
+            if (!streamed || streamed->isSpawned || streamed->maxX < despawnLeft) continue;
+
+            spawn(registry, physicsWorld, entity, *streamed);
+        }
+    }
+
+    void BodyStreamer::clear()
+    {
+        entries.clear();
+        spawned.clear();
+        sorted = true;
+        next_entry = 0;
+        last_window_left = 0.f;
+    }
+
+    void BodyStreamer::spawn(entt::registry& registry, const b2WorldId physicsWorld, const entt::entity entity,
+                             StreamedBodyComponent& streamed)
+    {
+        const b2BodyDef bodyDef = ecs::EntityFactory::createBodyDef(entity, streamed.object);
+        b2BodyId body = b2_nullBodyId;
+        while (!pool.empty() && !b2Body_IsValid(body))
+        {
+            body = pool.back();
+            pool.pop_back();
+        }
+
+        if (b2Body_IsValid(body))
+        {
+            if (b2Body_GetType(body) != bodyDef.type) b2Body_SetType(body, bodyDef.type);
+            b2Body_SetTransform(body, bodyDef.position, bodyDef.rotation);
+            b2Body_SetUserData(body, bodyDef.userData);
+            b2Body_Enable(body);
+        }
+        else
+        {
+            body = b2CreateBody(physicsWorld, &bodyDef);
+        }
+
+        const b2ShapeId shape = ecs::EntityFactory::createShape(body, streamed.object);
+        registry.emplace_or_replace<ecs::PhysicsComponent>(entity, physicsWorld, body, shape);
+
+        if (auto* groupParent = registry.try_get<ecs::PhysicsGroupParent>(entity))
+        {
+            groupParent->bodyID = body;
+        }
+        for (const auto child : streamed.children)
+        {
+            if (!registry.valid(child) || !registry.all_of<ecs::PhysicsGroupChild>(child)) continue;
+
+            const auto& initial = registry.get<ecs::InitialTransformComponent>(child);
+            const ecs::TagId tag = registry.get<ecs::TagComponent>(child).id;
+            registry.patch<ecs::PhysicsGroupChild>(child, [&](auto& groupChild)
+            {
+                groupChild.shapeId = ecs::EntityFactory::createGroupChildShape(
+                    body, child, tag, groupChild.localOffset, initial.scale, initial.zRotation);
+                groupChild.isActive = true;
+            });
+        }
+
+        streamed.isSpawned = true;
+        spawned.push_back(entity);
+    }
+
+    void BodyStreamer::despawn(entt::registry& registry, const entt::entity entity)
+    {
+        auto& streamed = registry.get<StreamedBodyComponent>(entity);
+        streamed.isSpawned = false;
+
+        for (const auto child : streamed.children)
+        {
+            if (auto* groupChild = registry.valid(child) ? registry.try_get<ecs::PhysicsGroupChild>(child) : nullptr)
+            {
+                groupChild->shapeId = b2_nullShapeId;
+            }
+        }
+
+        const auto* physicsComp = registry.try_get<ecs::PhysicsComponent>(entity);
+        if (!physicsComp) return;
+
+        // The body may have been destroyed with its entity's physics, e.g. by the editor
+        if (const b2BodyId body = physicsComp->body; b2Body_IsValid(body))
+        {
+            std::vector<b2ShapeId> shapes(b2Body_GetShapeCount(body));
+            b2Body_GetShapes(body, shapes.data(), static_cast<int>(shapes.size()));
+            for (const b2ShapeId shape : shapes)
+            {
+                b2DestroyShape(shape, false);
+            }
+            b2Body_Disable(body);
+            pool.push_back(body);
+        }
+        registry.remove<ecs::PhysicsComponent>(entity);
+    }
+}
@@ -0,0 +1,161 @@
+/**
+* @file BakedTexture.cpp
+ * @brief Implements reading and writing of baked textures.
+ */
+#include "engine/rendering/BakedTexture.h"
+#include <algorithm>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+#include "engine/FileFingerprint.h"
+
+namespace gl3::engine::rendering
+{
+    BakedTexture::BakedTexture(const std::filesystem::path& path) : file(path)
+    {
+        const auto invalid = [&](const std::string& reason)
+        {
+            return std::runtime_error("BakedTexture: " + path.string() + " " + reason);
+        };
+
+        if (file.size() < sizeof(BakedTextureHeader)) throw invalid("is too small");
+        header = reinterpret_cast<const BakedTextureHeader*>(file.data());
+        if (header->magic != BakedTextureHeader::expectedMagic) throw invalid("is not a baked texture");
+        if (header->version != BakedTextureHeader::currentVersion) throw invalid("has an outdated version");
+        if (header->mipCount == 0) throw invalid("has no mip levels");
+
+        const size_t tableEnd = sizeof(BakedTextureHeader) + header->mipCount * sizeof(BakedMipLevel);
+        if (file.size() < tableEnd) throw invalid("is truncated");
+        levels = reinterpret_cast<const BakedMipLevel*>(file.data() + sizeof(BakedTextureHeader));
+
+        for (uint32_t level = 0; level < header->mipCount; ++level)
+        {
+            const auto& mip = levels[level];
+            if (mip.size != static_cast<uint64_t>(mip.width) * mip.height * 4 || mip.offset + mip.size > file.size())
+            {
+                throw invalid("has a broken mip table");
+            }
+        }
+    }
+
+    std::filesystem::path BakedTexture::bakedPathFor(const std::filesystem::path& imagePath)
+    {
+        const auto folder = imagePath.parent_path();
+        return folder.parent_path() / "baked" / folder.filename() / imagePath.stem().concat(extension);
+    }
+
+    std::unique_ptr<BakedTexture> BakedTexture::openFor(const std::filesystem::path& imagePath)
+    {
+        const auto bakedPath = bakedPathFor(imagePath);
+        if (BakedTextureHeader header; !readHeader(bakedPath, header) ||
+            !FileFingerprint::isCurrent(imagePath, bakedPath, header))
+        {
+            return nullptr;
+        }
+        return std::make_unique<BakedTexture>(bakedPath);
+    }
+
+    bool BakedTexture::readHeader(const std::filesystem::path& path, BakedTextureHeader& header)
+    {
+        std::ifstream stream(path, std::ios::binary);
+        if (!stream) return false;
+        stream.read(reinterpret_cast<char*>(&header), sizeof(header));
+        return stream && header.magic == BakedTextureHeader::expectedMagic &&
+            header.version == BakedTextureHeader::currentVersion;
+    }
+
+    ImageData BakedTexture::downsample(const ImageData& image)
+    {
+        ImageData next;
+        next.width = std::max(1, image.width / 2);
+        next.height = std::max(1, image.height / 2);
+        next.channels = image.channels;
+        next.pixels.resize(static_cast<size_t>(next.width) * next.height * 4);
+
+        const auto texel = [&](const int x, const int y, const int channel)
+        {
+            const int clampedX = std::min(x, image.width - 1);
+            const int clampedY = std::min(y, image.height - 1);
+            return static_cast<unsigned>(image.pixels[(static_cast<size_t>(clampedY) * image.width + clampedX) * 4 +
+                channel]);
+        };
+
+        for (int y = 0; y < next.height; ++y)
+        {
+            for (int x = 0; x < next.width; ++x)
+            {
+                for (int channel = 0; channel < 4; ++channel)
+                {
+                    const unsigned sum = texel(2 * x, 2 * y, channel) + texel(2 * x + 1, 2 * y, channel) +
+                        texel(2 * x, 2 * y + 1, channel) + texel(2 * x + 1, 2 * y + 1, channel);
+                    next.pixels[(static_cast<size_t>(y) * next.width + x) * 4 + channel] =
+                        static_cast<unsigned char>((sum + 2) / 4);
+                }
+            }
+        }
+        return next;
+    }
+
+    void BakedTexture::write(const ImageData& image, const int tilesX, const int tilesY, const uint64_t sourceSize,
+                             const uint64_t sourceHash, const int64_t sourceWriteTime,
+                             const std::filesystem::path& path)
+    {
+        std::vector<ImageData> chain;
+        chain.push_back(image);
+        while (chain.back().width > 1 || chain.back().height > 1)
+        {
+            chain.push_back(downsample(chain.back()));
+        }
+
+        BakedTextureHeader header;
+        header.width = static_cast<uint32_t>(image.width);
+        header.height = static_cast<uint32_t>(image.height);
+        header.mipCount = static_cast<uint32_t>(chain.size());
+        header.tilesX = static_cast<uint32_t>(tilesX);
+        header.tilesY = static_cast<uint32_t>(tilesY);
+        header.sourceChannels = static_cast<uint32_t>(image.channels);
+        header.sourceSize = sourceSize;
+        header.sourceHash = sourceHash;
+        header.sourceWriteTime = sourceWriteTime;
+
+        std::vector<BakedMipLevel> table;
+        uint64_t offset = sizeof(BakedTextureHeader) + chain.size() * sizeof(BakedMipLevel);
+        for (const auto& level : chain)
+        {
+            table.push_back({
+                static_cast<uint32_t>(level.width), static_cast<uint32_t>(level.height), offset, level.pixels.size()
+            });
+            offset += level.pixels.size();
+        }
+
+        std::filesystem::create_directories(path.parent_path());
+        std::ofstream stream(path, std::ios::binary | std::ios::trunc);
+        if (!stream)
+        {
+            throw std::runtime_error("BakedTexture: Failed to write " + path.string());
+        }
+        stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        stream.write(reinterpret_cast<const char*>(table.data()),
+                     static_cast<std::streamsize>(table.size() * sizeof(BakedMipLevel)));
+        for (const auto& level : chain)
+        {
+            stream.write(reinterpret_cast<const char*>(level.pixels.data()),
+                         static_cast<std::streamsize>(level.pixels.size()));
+        }
+        if (!stream)
+        {
+            throw std::runtime_error("BakedTexture: Failed to write " + path.string());
+        }
+    }
+
+    ImageData BakedTexture::toImage() const
+    {
+        ImageData image;
+        image.width = static_cast<int>(header->width);
+        image.height = static_cast<int>(header->height);
+        image.channels = static_cast<int>(header->sourceChannels);
+        const auto* pixels = reinterpret_cast<const unsigned char*>(getPixels(0));
+        image.pixels.assign(pixels, pixels + levels[0].size);
+        return image;
+    }
+}
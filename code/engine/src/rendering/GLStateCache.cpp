@@ -0,0 +1,128 @@
+/**
+* @file GLStateCache.cpp
+ * @brief Implements the GLStateCache for skipping redundant OpenGL state changes.
+ */
+#include "engine/rendering/GLStateCache.h"
+
+namespace gl3::engine::rendering
+{
+    GLuint GLStateCache::current_program = unknown;
+    GLuint GLStateCache::current_vao = unknown;
+    std::array<GLuint, GLStateCache::maxTextureUnits> GLStateCache::current_textures = [] {
+        std::array<GLuint, maxTextureUnits> textures{};
+        textures.fill(unknown);
+        return textures;
+    }();
+    std::array<SamplerType, GLStateCache::maxTextureUnits> GLStateCache::current_samplers{};
+    std::array<bool, GLStateCache::maxTextureUnits> GLStateCache::sampler_known{};
+    GLuint GLStateCache::active_unit = unknown;
+    std::array<GLuint, 3> GLStateCache::samplers{};
+    GLStateCache::Counters GLStateCache::counters;
+
+    void GLStateCache::useProgram(const GLuint program)
+    {
+        if (current_program == program)
+        {
+            ++counters.skipped;
+            return;
+        }
+        glUseProgram(program);
+        current_program = program;
+        ++counters.issued;
+    }
+
+    void GLStateCache::bindVertexArray(const GLuint vao)
+    {
+        if (current_vao == vao)
+        {
+            ++counters.skipped;
+            return;
+        }
+        glBindVertexArray(vao);
+        current_vao = vao;
+        ++counters.issued;
+    }
+
+    void GLStateCache::bindTexture(const GLuint unit, const GLuint texture)
+    {
+        if (current_textures[unit] == texture)
+        {
+            ++counters.skipped;
+            return;
+        }
+        if (active_unit != unit)
+        {
+            glActiveTexture(GL_TEXTURE0 + unit);
+            active_unit = unit;
+        }
+        glBindTexture(GL_TEXTURE_2D, texture);
+        current_textures[unit] = texture;
+        ++counters.issued;
+    }
+
+    void GLStateCache::bindSampler(const GLuint unit, const SamplerType sampler)
+    {
+        if (sampler_known[unit] && current_samplers[unit] == sampler)
+        {
+            ++counters.skipped;
+            return;
+        }
+        createSamplers();
+        glBindSampler(unit, samplers[static_cast<size_t>(sampler)]);
+        current_samplers[unit] = sampler;
+        sampler_known[unit] = true;
+        ++counters.issued;
+    }
+
+    void GLStateCache::invalidate()
+    {
+        current_program = unknown;
+        current_vao = unknown;
+        current_textures.fill(unknown);
+        sampler_known.fill(false);
+        active_unit = unknown;
+    }
+
+    void GLStateCache::forgetProgram(const GLuint program)
+    {
+        if (current_program == program) current_program = unknown;
+    }
+
+    void GLStateCache::forgetVertexArray(const GLuint vao)
+    {
+        if (current_vao == vao) current_vao = unknown;
+    }
+
+    void GLStateCache::forgetTexture(const GLuint texture)
+    {
+        for (auto& bound : current_textures)
+        {
+            if (bound == texture) bound = unknown;
+        }
+    }
+
+    void GLStateCache::createSamplers()
+    {
+        if (samplers[1] != 0) return;
+
+        glGenSamplers(2, &samplers[1]);
+        const auto setup = [](const GLuint sampler, const GLint wrap)
+        {
+            // Same filtering as the textures themselves
+            glSamplerParameteri(sampler, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+            glSamplerParameteri(sampler, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+            glSamplerParameteri(sampler, GL_TEXTURE_WRAP_S, wrap);
+            glSamplerParameteri(sampler, GL_TEXTURE_WRAP_T, wrap);
+        };
+        setup(samplers[static_cast<size_t>(SamplerType::Repeat)], GL_REPEAT);
+        setup(samplers[static_cast<size_t>(SamplerType::ClampToBorder)], GL_CLAMP_TO_BORDER);
+    }
+
+    void GLStateCache::releaseSamplers()
+    {
+        if (samplers[1] == 0) return;
+        glDeleteSamplers(2, &samplers[1]);
+        samplers = {};
+        sampler_known.fill(false);
+    }
+}
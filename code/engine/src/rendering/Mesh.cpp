@@ -4,6 +4,7 @@
  */
 #include "engine/rendering/Mesh.h"
 #include "glad/glad.h"
+#include "engine/rendering/GLStateCache.h"
 
 namespace gl3::engine::rendering
 {
@@ -24,7 +25,7 @@ namespace gl3::engine::rendering
     {
         // Generate and bind the Vertex Array Object.
         glGenVertexArrays(1, &VAO);
-        glBindVertexArray(VAO);
+        GLStateCache::bindVertexArray(VAO);
 
         // Bind VBO and EBO to the VAO.
         glBindBuffer(GL_ARRAY_BUFFER, VBO);
@@ -38,20 +39,22 @@ namespace gl3::engine::rendering
         glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5 * sizeof(float), reinterpret_cast<void*>(3 * sizeof(float)));
         glEnableVertexAttribArray(1);
 
-        glBindVertexArray(0);
+        GLStateCache::bindVertexArray(0);
     }
 
     void Mesh::draw() const
     {
-        glBindVertexArray(VAO);
+        GLStateCache::bindVertexArray(VAO);
         glDrawElements(GL_TRIANGLES, number_of_indices, GL_UNSIGNED_INT, nullptr);
-        glBindVertexArray(0);
     }
 
     void Mesh::release()
     {
         if (VAO)
+        {
+            GLStateCache::forgetVertexArray(VAO);
             glDeleteVertexArrays(1, &VAO);
+        }
         if (VBO)
             glDeleteBuffers(1, &VBO);
         if (EBO)
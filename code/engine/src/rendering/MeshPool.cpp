@@ -0,0 +1,44 @@
+/**
+* @file MeshPool.cpp
+ * @brief Implements the MeshPool holding the shared unit quad and unit triangle.
+ */
+#include "engine/rendering/MeshPool.h"
+
+namespace gl3::engine::rendering
+{
+    std::unique_ptr<Mesh> MeshPool::unit_quad;
+    std::unique_ptr<Mesh> MeshPool::unit_triangle;
+
+    const Mesh& MeshPool::get(const SpriteShape shape)
+    {
+        if (shape == SpriteShape::Triangle)
+        {
+            if (!unit_triangle)
+            {
+                unit_triangle = std::make_unique<Mesh>(std::vector{
+                                                           -0.5f, -0.5f, 0.0f, 0.0f, 0.0f, // Bottom-left
+                                                           0.5f, -0.5f, 0.0f, 1.0f, 0.0f, // Bottom-right
+                                                           0.0f, 0.5f, 0.0f, 0.5f, 1.0f // Top-center
+                                                       }, std::vector<unsigned int>{0, 1, 2});
+            }
+            return *unit_triangle;
+        }
+
+        if (!unit_quad)
+        {
+            unit_quad = std::make_unique<Mesh>(std::vector{
+                                                   -0.5f, 0.5f, 0.0f, 0.0f, 1.0f, // Top-left
+                                                   -0.5f, -0.5f, 0.0f, 0.0f, 0.0f, // Bottom-left
+                                                   0.5f, -0.5f, 0.0f, 1.0f, 0.0f, // Bottom-right
+                                                   0.5f, 0.5f, 0.0f, 1.0f, 1.0f // Top-right
+                                               }, std::vector<unsigned int>{0, 1, 2, 0, 2, 3});
+        }
+        return *unit_quad;
+    }
+
+    void MeshPool::clear()
+    {
+        unit_quad.reset();
+        unit_triangle.reset();
+    }
+}
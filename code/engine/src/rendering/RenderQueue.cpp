@@ -0,0 +1,181 @@
+/**
+* @file RenderQueue.cpp
+ * @brief Implements incremental back to front ordering of render-able entities.
+ */
+#include "engine/rendering/RenderQueue.h"
+#include <algorithm>
+#include <cmath>
+#include <ranges>
+
+namespace gl3::engine::rendering
+{
+    RenderQueue::RenderQueue(entt::registry& registry) : registry(registry)
+    {
+        for (const auto [entity, layer] : registry.view<ecs::ZLayerComponent>().each())
+        {
+            insert(entity, layer.zLayer);
+            if (registry.all_of<ecs::TransformComponent>(entity)) placeInGrid(entity);
+        }
+
+        registry.on_construct<ecs::ZLayerComponent>().connect<&RenderQueue::onLayerConstruct>(this);
+        registry.on_update<ecs::ZLayerComponent>().connect<&RenderQueue::onLayerUpdate>(this);
+        registry.on_destroy<ecs::ZLayerComponent>().connect<&RenderQueue::onLayerDestroy>(this);
+        registry.on_construct<ecs::RenderComponent>().connect<&RenderQueue::onRenderChange>(this);
+        registry.on_update<ecs::RenderComponent>().connect<&RenderQueue::onRenderChange>(this);
+        registry.on_construct<ecs::TransformComponent>().connect<&RenderQueue::onTransformChange>(this);
+        registry.on_update<ecs::TransformComponent>().connect<&RenderQueue::onTransformChange>(this);
+        registry.on_destroy<ecs::TransformComponent>().connect<&RenderQueue::onTransformDestroy>(this);
+    }
+
+    RenderQueue::~RenderQueue()
+    {
+        registry.on_construct<ecs::ZLayerComponent>().disconnect<&RenderQueue::onLayerConstruct>(this);
+        registry.on_update<ecs::ZLayerComponent>().disconnect<&RenderQueue::onLayerUpdate>(this);
+        registry.on_destroy<ecs::ZLayerComponent>().disconnect<&RenderQueue::onLayerDestroy>(this);
+        registry.on_construct<ecs::RenderComponent>().disconnect<&RenderQueue::onRenderChange>(this);
+        registry.on_update<ecs::RenderComponent>().disconnect<&RenderQueue::onRenderChange>(this);
+        registry.on_construct<ecs::TransformComponent>().disconnect<&RenderQueue::onTransformChange>(this);
+        registry.on_update<ecs::TransformComponent>().disconnect<&RenderQueue::onTransformChange>(this);
+        registry.on_destroy<ecs::TransformComponent>().disconnect<&RenderQueue::onTransformDestroy>(this);
+    }
+
+    void RenderQueue::update()
+    {
+        sorted_buckets = 0;
+        for (auto& bucket : buckets | std::views::values)
+        {
+            if (!bucket.dirty) continue;
+
+            std::vector<std::pair<RenderSortKey, entt::entity>> keyed;
+            keyed.reserve(bucket.entities.size());
+            for (const auto entity : bucket.entities)
+            {
+                keyed.emplace_back(makeKey(entity), entity);
+            }
+            std::ranges::sort(keyed, {}, &std::pair<RenderSortKey, entt::entity>::first);
+
+            for (size_t i = 0; i < keyed.size(); ++i)
+            {
+                bucket.entities[i] = keyed[i].second;
+                slots[keyed[i].second].index = i;
+            }
+            bucket.dirty = false;
+            ++sorted_buckets;
+        }
+    }
+
+    void RenderQueue::collectVisible(const float minX, const float maxX, std::vector<VisibleEntity>& visible) const
+    {
+        visible.clear();
+        grid.query(minX, maxX, [&](const entt::entity entity)
+        {
+            const Slot& slot = slots.at(entity);
+            visible.push_back({slot.layer, slot.index, entity});
+        });
+        std::ranges::sort(visible);
+    }
+
+    void RenderQueue::markDirty(const entt::entity entity)
+    {
+        if (const auto slot = slots.find(entity); slot != slots.end())
+        {
+            buckets[slot->second.layer].dirty = true;
+        }
+    }
+
+    void RenderQueue::onLayerConstruct(entt::registry& registry, const entt::entity entity)
+    {
+        insert(entity, registry.get<ecs::ZLayerComponent>(entity).zLayer);
+        // Entities usually get their transform after the layer, it is placed in the grid then
+        if (registry.all_of<ecs::TransformComponent>(entity)) placeInGrid(entity);
+    }
+
+    void RenderQueue::onLayerUpdate(entt::registry& registry, const entt::entity entity)
+    {
+        const float layer = registry.get<ecs::ZLayerComponent>(entity).zLayer;
+        if (const auto slot = slots.find(entity); slot != slots.end() && slot->second.layer == layer) return;
+
+        remove(entity);
+        insert(entity, layer);
+    }
+
+    void RenderQueue::onLayerDestroy(entt::registry&, const entt::entity entity)
+    {
+        remove(entity);
+        grid.remove(entity);
+    }
+
+    void RenderQueue::onRenderChange(entt::registry&, const entt::entity entity)
+    {
+        markDirty(entity);
+    }
+
+    void RenderQueue::onTransformChange(entt::registry&, const entt::entity entity)
+    {
+        if (slots.contains(entity)) placeInGrid(entity);
+    }
+
+    void RenderQueue::onTransformDestroy(entt::registry&, const entt::entity entity)
+    {
+        grid.remove(entity);
+    }
+
+    void RenderQueue::placeInGrid(const entt::entity entity)
+    {
+        const auto& transform = registry.get<ecs::TransformComponent>(entity);
+        // Half width of the rotated bounding box
+        const float rotation = glm::radians(transform.zRotation);
+        const float halfWidth = 0.5f * (std::abs(transform.scale.x * std::cos(rotation)) +
+            std::abs(transform.scale.y * std::sin(rotation)));
+        grid.place(entity, transform.position.x - halfWidth, transform.position.x + halfWidth);
+    }
+
+    void RenderQueue::insert(const entt::entity entity, const float layer)
+    {
+        auto& bucket = buckets[layer];
+        slots[entity] = {layer, bucket.entities.size()};
+        bucket.entities.push_back(entity);
+        bucket.dirty = true;
+    }
+
+    void RenderQueue::remove(const entt::entity entity)
+    {
+        const auto slot = slots.find(entity);
+        if (slot == slots.end()) return;
+
+        const auto bucket = buckets.find(slot->second.layer);
+        auto& entities = bucket->second.entities;
+        const size_t index = slot->second.index;
+        if (index != entities.size() - 1)
+        {
+            entities[index] = entities.back();
+            slots[entities[index]].index = index;
+            bucket->second.dirty = true;
+        }
+        entities.pop_back();
+        slots.erase(slot);
+
+        if (entities.empty())
+        {
+            buckets.erase(bucket);
+        }
+    }
+
+    RenderSortKey RenderQueue::makeKey(const entt::entity entity) const
+    {
+        RenderSortKey key;
+        key.entity = entt::to_integral(entity);
+        if (const auto* renderComp = registry.try_get<ecs::RenderComponent>(entity))
+        {
+            key.isCustomShader = !renderComp->isBatched;
+            // Batched sprites all go through the SpriteBatch shader, their own program doesn't matter
+            if (const auto* customShader = registry.try_get<ecs::CustomShaderComponent>(entity))
+            {
+                key.shader = reinterpret_cast<std::uintptr_t>(customShader->shader.get());
+            }
+            key.texture = renderComp->texture ? renderComp->texture->getID() : 0;
+            key.shape = renderComp->shape;
+        }
+        return key;
+    }
+}
@@ -3,11 +3,13 @@
  * @brief Implements the Shader class for compiling and linking GLSL shaders.
  */
 #include "engine/rendering/Shader.h"
+#include <algorithm>
 #include <fstream>
 #include <iostream>
 #include <sstream>
 #include <glm/gtc/type_ptr.hpp>
 #include "engine/Assets.h"
+#include "engine/rendering/GLStateCache.h"
 
 
 namespace gl3::engine::rendering
@@ -22,26 +24,97 @@ namespace gl3::engine::rendering
         char infoLog[GL_INFO_LOG_LENGTH];
     };
 
-    Shader::Shader(const fs::path& vertexShaderPath, const fs::path& fragmentShaderPath)
+    Shader::Shader(const fs::path& vertexShaderPath, const fs::path& fragmentShaderPath,
+                   const std::vector<std::string>& defines) : Shader(ShaderSources{
+        loadSource(vertexShaderPath, defines), loadSource(fragmentShaderPath, defines)
+    })
+    {
+    }
+
+    Shader::Shader(const ShaderSources& sources)
     {
         // Compile the vertex and fragment shaders
-        vertex_shader = loadAndCompileShader(GL_VERTEX_SHADER, vertexShaderPath);
-        fragment_shader = loadAndCompileShader(GL_FRAGMENT_SHADER, fragmentShaderPath);
+        vertex_shader = compileShader(GL_VERTEX_SHADER, sources.vertex);
+        fragment_shader = compileShader(GL_FRAGMENT_SHADER, sources.fragment);
         // Create the shader program and attach shaders.
         shader_program = glCreateProgram();
         glAttachShader(shader_program, vertex_shader);
         glAttachShader(shader_program, fragment_shader);
+        // Allow retrieving the program binary for the on-disk shader cache.
+        glProgramParameteri(shader_program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
         // Link the program.
         glLinkProgram(shader_program);
         // Shaders can be detached after linking.
         glDetachShader(shader_program, vertex_shader);
         glDetachShader(shader_program, fragment_shader);
+        checkLinkStatus();
+        reflectUniforms();
+    }
+
+    Shader::Shader(const GLenum binaryFormat, const std::vector<char>& binary)
+    {
+        shader_program = glCreateProgram();
+        glProgramBinary(shader_program, binaryFormat, binary.data(), static_cast<GLsizei>(binary.size()));
+        checkLinkStatus();
+        reflectUniforms();
+    }
+
+    void Shader::checkLinkStatus() const
+    {
+        glStatusData linkStatus{};
+        linkStatus.shaderName = "Program";
+        glGetProgramiv(shader_program, GL_LINK_STATUS, &linkStatus.success);
+        if (linkStatus.success == GL_FALSE)
+        {
+            glGetProgramInfoLog(shader_program, GL_INFO_LOG_LENGTH, nullptr, linkStatus.infoLog);
+            glDeleteProgram(shader_program);
+            glDeleteShader(vertex_shader);
+            glDeleteShader(fragment_shader);
+            throw std::runtime_error(
+                "ERROR: " + std::string(linkStatus.shaderName) + " linking failed.\n" +
+                std::string(linkStatus.infoLog));
+        }
     }
 
-    unsigned int Shader::loadAndCompileShader(const GLuint shaderType, const fs::path& shaderPath)
+    std::vector<char> Shader::getBinary(GLenum& binaryFormat) const
+    {
+        GLint length = 0;
+        glGetProgramiv(shader_program, GL_PROGRAM_BINARY_LENGTH, &length);
+        std::vector<char> binary(length);
+        if (length > 0)
+        {
+            glGetProgramBinary(shader_program, length, nullptr, &binaryFormat, binary.data());
+        }
+        return binary;
+    }
+
+    std::string Shader::loadSource(const fs::path& shaderPath, const std::vector<std::string>& defines)
+    {
+        auto source = readText(shaderPath);
+        if (defines.empty()) return source;
+
+        std::string defineBlock;
+        for (const auto& define : defines)
+        {
+            defineBlock += "#define " + define + "\n";
+        }
+        // #version has to stay the first statement of a shader
+        const auto versionPos = source.find("#version");
+        if (versionPos == std::string::npos)
+        {
+            return defineBlock + source;
+        }
+        const auto lineEnd = source.find('\n', versionPos);
+        if (lineEnd == std::string::npos)
+        {
+            return source + "\n" + defineBlock;
+        }
+        source.insert(lineEnd + 1, defineBlock);
+        return source;
+    }
+
+    unsigned int Shader::compileShader(const GLuint shaderType, const std::string& shaderSource)
     {
-        // Read shader source from file.
-        const auto shaderSource = readText(shaderPath);
         const auto source = shaderSource.c_str();
         // Create and compile shader.
         const auto shaderID = glCreateShader(shaderType);
@@ -55,6 +128,7 @@ namespace gl3::engine::rendering
         if (compilationStatus.success == GL_FALSE)
         {
             glGetShaderInfoLog(shaderID, GL_INFO_LOG_LENGTH, nullptr, compilationStatus.infoLog);
+            glDeleteShader(shaderID);
             throw std::runtime_error(
                 "ERROR: " + std::string(compilationStatus.shaderName) + " shader compilation failed.\n" +
                 std::string(compilationStatus.infoLog));
@@ -71,69 +145,150 @@ namespace gl3::engine::rendering
         return buffer.str();
     }
 
+    void Shader::reflectUniforms()
+    {
+        GLint uniformCount = 0;
+        GLint maxNameLength = 0;
+        glGetProgramiv(shader_program, GL_ACTIVE_UNIFORMS, &uniformCount);
+        glGetProgramiv(shader_program, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxNameLength);
+
+        std::string name(std::max(maxNameLength, 1), '\0');
+        for (GLint i = 0; i < uniformCount; ++i)
+        {
+            GLsizei length = 0;
+            GLint size = 0;
+            GLenum type = 0;
+            glGetActiveUniform(shader_program, static_cast<GLuint>(i), maxNameLength, &length, &size, &type,
+                               name.data());
+            std::string uniformName(name.data(), length);
+            const GLint location = glGetUniformLocation(shader_program, uniformName.c_str());
+            // Uniforms in blocks have no location
+            if (location < 0) continue;
+
+            // Arrays are reported as "name[0]", make them accessible by their plain name too
+            if (uniformName.ends_with("[0]"))
+            {
+                uniforms[uniformName.substr(0, uniformName.size() - 3)] = {location, type};
+            }
+            uniforms[std::move(uniformName)] = {location, type};
+        }
+    }
+
+    GLint Shader::locationOf(const std::string& name) const
+    {
+        const auto it = uniforms.find(name);
+        if (it == uniforms.end())
+        {
+            reportUniform(name, "not found or not used in shader");
+            return -1;
+        }
+        return it->second.location;
+    }
+
+    void Shader::reportUniform(const std::string& name, const char* problem) const
+    {
+        if (reported_uniforms.insert(name).second)
+        {
+            std::cerr << "Warning: uniform '" << name << "' " << problem << " (program " << shader_program << ")." <<
+                std::endl;
+        }
+    }
+
+    bool Shader::expectUniforms(const std::vector<std::string>& names) const
+    {
+        bool allFound = true;
+        for (const auto& name : names)
+        {
+            if (!uniforms.contains(name))
+            {
+                reportUniform(name, "not found or not used in shader");
+                allFound = false;
+            }
+        }
+        return allFound;
+    }
+
+    void Shader::set(const UniformHandle<glm::mat4> handle, const glm::mat4& matrix) const
+    {
+        glUniformMatrix4fv(handle.location, 1, GL_FALSE, glm::value_ptr(matrix));
+    }
+
+    void Shader::set(const UniformHandle<float> handle, const float value) const
+    {
+        glUniform1f(handle.location, value);
+    }
+
+    void Shader::set(const UniformHandle<int> handle, const int value) const
+    {
+        glUniform1i(handle.location, value);
+    }
+
+    void Shader::set(const UniformHandle<glm::vec2> handle, const glm::vec2& value) const
+    {
+        glUniform2fv(handle.location, 1, glm::value_ptr(value));
+    }
+
+    void Shader::set(const UniformHandle<glm::vec3> handle, const glm::vec3& value) const
+    {
+        glUniform3fv(handle.location, 1, glm::value_ptr(value));
+    }
+
+    void Shader::set(const UniformHandle<glm::vec4> handle, const glm::vec4& value) const
+    {
+        glUniform4fv(handle.location, 1, glm::value_ptr(value));
+    }
+
     void Shader::setMat4(const std::string& uniformName, glm::mat4 matrix) const
     {
-        const auto uniformLocation = glGetUniformLocation(shader_program, uniformName.c_str());
-        glUniformMatrix4fv(uniformLocation, 1, GL_FALSE, glm::value_ptr(matrix));
+        glUniformMatrix4fv(locationOf(uniformName), 1, GL_FALSE, glm::value_ptr(matrix));
     }
 
     void Shader::setFloat(const std::string& uniformName, const float value) const
     {
-        const GLint location = glGetUniformLocation(shader_program, uniformName.c_str());
-        glUniform1f(location, value);
+        glUniform1f(locationOf(uniformName), value);
     }
 
     void Shader::setFloatArray(const std::string& name, const float* values, const int count) const
     {
-        const GLint location = glGetUniformLocation(shader_program, name.c_str());
-        if (location == -1)
-        {
-            std::cerr << "Warning: uniform '" << name << "' not found or not used.\n";
-            return;
-        }
+        const GLint location = locationOf(name);
+        if (location == -1) return;
         glUniform1fv(location, count, values);
     }
 
     void Shader::setVec2(const std::string& uniformName, const glm::vec2& value) const
     {
-        const GLint location = glGetUniformLocation(shader_program, uniformName.c_str());
-        glUniform2fv(location, 1, glm::value_ptr(value));
+        glUniform2fv(locationOf(uniformName), 1, glm::value_ptr(value));
     }
 
     void Shader::setVec3(const std::string& uniformName, const glm::vec3& value) const
     {
-        const GLint location = glGetUniformLocation(shader_program, uniformName.c_str());
-        glUniform3fv(location, 1, glm::value_ptr(value));
+        glUniform3fv(locationOf(uniformName), 1, glm::value_ptr(value));
     }
 
     void Shader::setVector4(const std::string& uniformName, glm::vec4 vector) const
     {
-        const auto uniformLocation = glGetUniformLocation(shader_program, uniformName.c_str());
-        glUniform4fv(uniformLocation, 1, glm::value_ptr(vector));
+        glUniform4fv(locationOf(uniformName), 1, glm::value_ptr(vector));
     }
 
     void Shader::setInt(const std::string& name, const int value) const
     {
-        const GLint location = glGetUniformLocation(shader_program, name.c_str());
-        if (location == -1)
-        {
-            std::cerr << "Warning: uniform '" << name << "' not found or not used in shader." << std::endl;
-        }
-        glUniform1i(location, value);
+        glUniform1i(locationOf(name), value);
     }
 
     void Shader::use() const
     {
-        glUseProgram(shader_program);
+        GLStateCache::useProgram(shader_program);
     }
 
     Shader::~Shader()
     {
         if (shader_program != 0)
         {
+            GLStateCache::forgetProgram(shader_program);
             glDeleteProgram(shader_program);
-            glDeleteShader(vertex_shader);
-            glDeleteShader(fragment_shader);
+            // Programs created from a binary have no shader objects
+            if (vertex_shader != 0) glDeleteShader(vertex_shader);
+            if (fragment_shader != 0) glDeleteShader(fragment_shader);
             shader_program = 0;
             vertex_shader = 0;
             fragment_shader = 0;
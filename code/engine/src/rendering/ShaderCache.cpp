@@ -0,0 +1,169 @@
+/**
+* @file ShaderCache.cpp
+ * @brief Implements the ShaderCache for sharing compiled shader programs and caching program binaries on disk.
+ */
+#include "engine/rendering/ShaderCache.h"
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include "engine/FileFingerprint.h"
+
+namespace gl3::engine::rendering
+{
+    std::unordered_map<std::string, ShaderHandle> ShaderCache::shader_cache;
+    fs::path ShaderCache::binary_cache_directory;
+
+    /**
+     * @brief Header in front of every stored program binary.
+     */
+    struct ProgramBinaryHeader
+    {
+        uint32_t magic; ///< Always programBinaryMagic.
+        uint32_t format; ///< Driver specific binary format.
+        uint32_t length; ///< Length of the binary following the header in bytes.
+    };
+
+    static constexpr uint32_t programBinaryMagic = 0x42505845; // "EXPB"
+
+    ShaderHandle ShaderCache::get(const fs::path& vertexShaderPath, const fs::path& fragmentShaderPath,
+                                  const std::vector<std::string>& defines)
+    {
+        const auto key = makeKey(vertexShaderPath, fragmentShaderPath, defines);
+        if (const auto it = shader_cache.find(key); it != shader_cache.end())
+        {
+            return it->second;
+        }
+
+        ShaderHandle shader;
+        if (binary_cache_directory.empty())
+        {
+            shader = std::make_shared<const Shader>(vertexShaderPath, fragmentShaderPath, defines);
+        }
+        else
+        {
+            // Read once, the sources key the binary and are compiled on a miss
+            const ShaderSources sources{
+                Shader::loadSource(vertexShaderPath, defines), Shader::loadSource(fragmentShaderPath, defines)
+            };
+            shader = loadBinary(sources.vertex, sources.fragment);
+            if (!shader)
+            {
+                shader = std::make_shared<const Shader>(sources);
+                storeBinary(sources.vertex, sources.fragment, *shader);
+            }
+        }
+
+        shader_cache.emplace(key, shader);
+        return shader;
+    }
+
+    void ShaderCache::enableProgramBinaryCache(const fs::path& directory)
+    {
+        GLint formatCount = 0;
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount);
+        if (formatCount == 0)
+        {
+            std::cerr << "Warning: driver supports no program binary formats, shader binary cache disabled." <<
+                std::endl;
+            return;
+        }
+
+        std::error_code error;
+        create_directories(directory, error);
+        if (error)
+        {
+            std::cerr << "Warning: could not create shader binary cache directory " << directory << ": " <<
+                error.message() << std::endl;
+            return;
+        }
+        binary_cache_directory = directory;
+    }
+
+    void ShaderCache::disableProgramBinaryCache()
+    {
+        binary_cache_directory.clear();
+    }
+
+    size_t ShaderCache::releaseUnused()
+    {
+        return std::erase_if(shader_cache, [](const auto& entry)
+        {
+            return entry.second.use_count() == 1;
+        });
+    }
+
+    void ShaderCache::clear()
+    {
+        shader_cache.clear();
+    }
+
+    std::string ShaderCache::makeKey(const fs::path& vertexShaderPath, const fs::path& fragmentShaderPath,
+                                     const std::vector<std::string>& defines)
+    {
+        std::string key = vertexShaderPath.generic_string() + '|' + fragmentShaderPath.generic_string();
+        for (const auto& define : defines)
+        {
+            key += '|' + define;
+        }
+        return key;
+    }
+
+    fs::path ShaderCache::binaryPath(const std::string& vertexSource, const std::string& fragmentSource)
+    {
+        // The same sources may produce incompatible binaries on another GPU or driver version
+        const auto renderer = reinterpret_cast<const char*>(glGetString(GL_RENDERER));
+        const auto version = reinterpret_cast<const char*>(glGetString(GL_VERSION));
+
+        uint64_t hash = FileFingerprint::hash(vertexSource);
+        hash = FileFingerprint::hash(fragmentSource, FileFingerprint::hash("\n--fragment--\n", hash));
+        hash = FileFingerprint::hash(renderer ? renderer : "", hash);
+        hash = FileFingerprint::hash(version ? version : "", hash);
+
+        std::ostringstream fileName;
+        fileName << std::hex << hash << ".bin";
+        return binary_cache_directory / fileName.str();
+    }
+
+    ShaderHandle ShaderCache::loadBinary(const std::string& vertexSource, const std::string& fragmentSource)
+    {
+        std::ifstream file(binaryPath(vertexSource, fragmentSource), std::ios::binary);
+        if (!file) return nullptr;
+
+        ProgramBinaryHeader header{};
+        file.read(reinterpret_cast<char*>(&header), sizeof(header));
+        if (!file || header.magic != programBinaryMagic || header.length == 0) return nullptr;
+
+        std::vector<char> binary(header.length);
+        file.read(binary.data(), static_cast<std::streamsize>(binary.size()));
+        if (!file) return nullptr;
+
+        try
+        {
+            return std::make_shared<const Shader>(static_cast<GLenum>(header.format), binary);
+        }
+        catch (const std::runtime_error&)
+        {
+            // Driver rejected the binary, fall back to compiling and overwrite it
+            return nullptr;
+        }
+    }
+
+    void ShaderCache::storeBinary(const std::string& vertexSource, const std::string& fragmentSource,
+                                  const Shader& shader)
+    {
+        GLenum format = 0;
+        const auto binary = shader.getBinary(format);
+        if (binary.empty()) return;
+
+        std::ofstream file(binaryPath(vertexSource, fragmentSource), std::ios::binary | std::ios::trunc);
+        if (!file)
+        {
+            std::cerr << "Warning: could not write shader binary to " << binary_cache_directory << std::endl;
+            return;
+        }
+        const ProgramBinaryHeader header{programBinaryMagic, format, static_cast<uint32_t>(binary.size())};
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(binary.data(), static_cast<std::streamsize>(binary.size()));
+    }
+}
@@ -0,0 +1,115 @@
+/**
+* @file SpatialGrid.cpp
+ * @brief Implements the uniform x grid used for visibility culling.
+ */
+#include "engine/rendering/SpatialGrid.h"
+#include <cmath>
+#include <functional>
+
+namespace gl3::engine::rendering
+{
+    SpatialGrid::SpatialGrid(const float cellSize) : cell_size(cellSize)
+    {
+    }
+
+    void SpatialGrid::place(const entt::entity entity, const float minX, const float maxX)
+    {
+        Placement placement;
+        placement.firstCell = cellOf(minX);
+        placement.lastCell = cellOf(maxX);
+        placement.isWide = placement.lastCell - placement.firstCell >= maxCellsPerEntity;
+
+        const auto existing = placements.find(entity);
+        if (existing != placements.end())
+        {
+            const Placement& old = existing->second;
+            // Moved inside its cells, the common case for every frame
+            if (old.isWide == placement.isWide &&
+                (placement.isWide || (old.firstCell == placement.firstCell && old.lastCell == placement.lastCell)))
+            {
+                return;
+            }
+            unlink(entity, old);
+            existing->second = placement;
+        }
+        else
+        {
+            placements.emplace(entity, placement);
+        }
+        link(entity, placement);
+    }
+
+    void SpatialGrid::remove(const entt::entity entity)
+    {
+        const auto placement = placements.find(entity);
+        if (placement == placements.end()) return;
+
+        unlink(entity, placement->second);
+        placements.erase(placement);
+    }
+
+    void SpatialGrid::clear()
+    {
+        cells.clear();
+        wide_entities.clear();
+        placements.clear();
+        first_cell = 0;
+    }
+
+    int SpatialGrid::cellOf(const float x) const
+    {
+        return static_cast<int>(std::floor(x / cell_size));
+    }
+
+    std::vector<SpatialGrid::CellEntry>& SpatialGrid::getCell(const int index)
+    {
+        if (cells.empty())
+        {
+            first_cell = index;
+        }
+        if (index < first_cell)
+        {
+            cells.insert(cells.begin(), first_cell - index, {});
+            first_cell = index;
+        }
+        if (const auto offset = static_cast<size_t>(index - first_cell); offset >= cells.size())
+        {
+            cells.resize(offset + 1);
+        }
+        return cells[index - first_cell];
+    }
+
+    void SpatialGrid::link(const entt::entity entity, const Placement& placement)
+    {
+        if (placement.isWide)
+        {
+            wide_entities.push_back(entity);
+            return;
+        }
+        for (int cell = placement.firstCell; cell <= placement.lastCell; ++cell)
+        {
+            getCell(cell).push_back({entity, placement.firstCell});
+        }
+    }
+
+    void SpatialGrid::unlink(const entt::entity entity, const Placement& placement)
+    {
+        const auto swapRemove = [entity](auto& entries, auto projection)
+        {
+            const auto found = std::ranges::find(entries, entity, projection);
+            if (found == entries.end()) return;
+            *found = entries.back();
+            entries.pop_back();
+        };
+
+        if (placement.isWide)
+        {
+            swapRemove(wide_entities, std::identity{});
+            return;
+        }
+        for (int cell = placement.firstCell; cell <= placement.lastCell; ++cell)
+        {
+            swapRemove(cells[cell - first_cell], &CellEntry::entity);
+        }
+    }
+}
@@ -0,0 +1,169 @@
+/**
+* @file SpriteBatch.cpp
+ * @brief Implements the SpriteBatch class for instanced sprite rendering.
+ */
+#include "engine/rendering/SpriteBatch.h"
+#include <algorithm>
+#include <cstddef>
+#include "engine/rendering/GLStateCache.h"
+
+namespace gl3::engine::rendering
+{
+    SpriteBatch::SpriteBatch() : shader(ShaderCache::get("shaders/sprite.vert", "shaders/sprite.frag")),
+                                 texture_uniform(shader->getUniform<int>("texture1"))
+    {
+        glGenBuffers(1, &instance_buffer);
+
+        quad = createGeometry(MeshPool::get(SpriteShape::Quad));
+        triangle = createGeometry(MeshPool::get(SpriteShape::Triangle));
+    }
+
+    SpriteBatch::~SpriteBatch()
+    {
+        for (const auto* geometry : {&quad, &triangle})
+        {
+            if (geometry->VAO)
+            {
+                GLStateCache::forgetVertexArray(geometry->VAO);
+                glDeleteVertexArrays(1, &geometry->VAO);
+            }
+        }
+        if (instance_buffer)
+            glDeleteBuffers(1, &instance_buffer);
+    }
+
+    SpriteBatch::UnitGeometry SpriteBatch::createGeometry(const Mesh& mesh) const
+    {
+        UnitGeometry geometry;
+        geometry.indexCount = static_cast<GLsizei>(mesh.getIndexCount());
+
+        glGenVertexArrays(1, &geometry.VAO);
+        GLStateCache::bindVertexArray(geometry.VAO);
+
+        // Share vertex and index buffers with the unit mesh
+        glBindBuffer(GL_ARRAY_BUFFER, mesh.getVBO());
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh.getEBO());
+
+        // Per-vertex attributes: location 0 position, location 1 uv (same as Mesh)
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 5 * sizeof(float), nullptr);
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5 * sizeof(float), reinterpret_cast<void*>(3 * sizeof(float)));
+        glEnableVertexAttribArray(1);
+
+        // Per-instance attributes: model matrix (locations 2-5), uvRect (6), color (7), uvParams (8), atlasRect (9)
+        glBindBuffer(GL_ARRAY_BUFFER, instance_buffer);
+        constexpr auto stride = static_cast<GLsizei>(sizeof(SpriteInstance));
+        for (GLuint column = 0; column < 4; ++column)
+        {
+            const GLuint location = 2 + column;
+            glVertexAttribPointer(location, 4, GL_FLOAT, GL_FALSE, stride,
+                                  reinterpret_cast<void*>(offsetof(SpriteInstance, model) + column * sizeof(glm::vec4)));
+            glEnableVertexAttribArray(location);
+            glVertexAttribDivisor(location, 1);
+        }
+        glVertexAttribPointer(6, 4, GL_FLOAT, GL_FALSE, stride,
+                              reinterpret_cast<void*>(offsetof(SpriteInstance, uvRect)));
+        glEnableVertexAttribArray(6);
+        glVertexAttribDivisor(6, 1);
+        glVertexAttribPointer(7, 4, GL_FLOAT, GL_FALSE, stride,
+                              reinterpret_cast<void*>(offsetof(SpriteInstance, color)));
+        glEnableVertexAttribArray(7);
+        glVertexAttribDivisor(7, 1);
+        glVertexAttribPointer(8, 4, GL_FLOAT, GL_FALSE, stride,
+                              reinterpret_cast<void*>(offsetof(SpriteInstance, uvParams)));
+        glEnableVertexAttribArray(8);
+        glVertexAttribDivisor(8, 1);
+        glVertexAttribPointer(9, 4, GL_FLOAT, GL_FALSE, stride,
+                              reinterpret_cast<void*>(offsetof(SpriteInstance, atlasRect)));
+        glEnableVertexAttribArray(9);
+        glVertexAttribDivisor(9, 1);
+
+        GLStateCache::bindVertexArray(0);
+        return geometry;
+    }
+
+    void SpriteBatch::begin()
+    {
+        pending.clear();
+        draw_calls = 0;
+        sprite_count = 0;
+    }
+
+    void SpriteBatch::submit(const SpriteBatchKey& key, const SpriteInstance& instance)
+    {
+        pending.push_back({key, instance});
+    }
+
+    void SpriteBatch::uploadInstances()
+    {
+        const size_t count = instance_data.size();
+        glBindBuffer(GL_ARRAY_BUFFER, instance_buffer);
+        if (count > instance_capacity)
+        {
+            // Grow geometrically, so a level with many sprites only reallocates a few times
+            instance_capacity = std::max(count, instance_capacity * 2);
+            glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(instance_capacity * sizeof(SpriteInstance)), nullptr,
+                         GL_STREAM_DRAW);
+        }
+        else
+        {
+            // Orphan the previous storage, so we don't wait for draws still reading from it
+            glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(instance_capacity * sizeof(SpriteInstance)), nullptr,
+                         GL_STREAM_DRAW);
+        }
+        glBufferSubData(GL_ARRAY_BUFFER, 0, static_cast<GLsizeiptr>(count * sizeof(SpriteInstance)),
+                        instance_data.data());
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    }
+
+    void SpriteBatch::flush()
+    {
+        if (pending.empty()) return;
+
+        // Group by render state, inside a group keep back to front submission order
+        std::ranges::stable_sort(pending, [](const PendingSprite& lhs, const PendingSprite& rhs)
+        {
+            return lhs.key < rhs.key;
+        });
+
+        instance_data.clear();
+        instance_data.reserve(pending.size());
+        for (const auto& sprite : pending)
+        {
+            instance_data.push_back(sprite.instance);
+        }
+        uploadInstances();
+
+        shader->use();
+        shader->set(texture_uniform, 0);
+
+        size_t runStart = 0;
+        for (size_t i = 1; i <= pending.size(); ++i)
+        {
+            if (i == pending.size() || pending[i].key != pending[runStart].key)
+            {
+                drawRun(pending[runStart].key, runStart, i - runStart);
+                runStart = i;
+            }
+        }
+
+        sprite_count += pending.size();
+        pending.clear();
+    }
+
+    void SpriteBatch::drawRun(const SpriteBatchKey& key, const size_t first, const size_t count)
+    {
+        if (key.texture)
+        {
+            GLStateCache::bindTexture(0, key.texture);
+            // The shader repeats or clamps inside each sprite's atlas rect, so one sampler serves every sprite
+            GLStateCache::bindSampler(0, SamplerType::Repeat);
+        }
+
+        const UnitGeometry& geometry = key.shape == SpriteShape::Triangle ? triangle : quad;
+        GLStateCache::bindVertexArray(geometry.VAO);
+        glDrawElementsInstancedBaseInstance(GL_TRIANGLES, geometry.indexCount, GL_UNSIGNED_INT, nullptr,
+                                            static_cast<GLsizei>(count), static_cast<GLuint>(first));
+        ++draw_calls;
+    }
+}
@@ -3,7 +3,11 @@
  * @brief Implements the Texture class for loading and managing OpenGL textures.
  */
 #include "engine/rendering/Texture.h"
+#include <algorithm>
+#include <regex>
 #include <stdexcept>
+#include "engine/rendering/BakedTexture.h"
+#include "engine/rendering/GLStateCache.h"
 
 #define STB_IMAGE_IMPLEMENTATION
 #include "engine/Assets.h"
@@ -14,61 +18,166 @@ namespace gl3::engine::rendering
 {
     Texture::Texture(const std::string& path, const int tilesX, const int tilesY)
     {
-        // Generate an OpenGL texture object.
-        glGenTextures(1, &ID);
-        glBindTexture(GL_TEXTURE_2D, ID);
+        upload(loadImage(path));
+        // Extract the base file name (without extension).
+        const std::filesystem::path file = path;
+        file_name = file.stem().string();
+        setupTiles(file.filename().string(), tilesX, tilesY);
+    }
 
-        // Set wrapping and filtering options
+    Texture::Texture(const ImageData& image, const std::string& name, const int tilesX, const int tilesY)
+    {
+        upload(image);
+        file_name = name;
+        setupTiles(name, tilesX, tilesY);
+    }
+
+    Texture::Texture(const BakedTexture& baked, const std::string& name)
+    {
+        const auto& header = baked.getHeader();
+        width = static_cast<int>(header.width);
+        height = static_cast<int>(header.height);
+
+        glGenTextures(1, &ID);
+        GLStateCache::bindTexture(0, ID);
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, static_cast<GLint>(header.mipCount) - 1);
 
-        int nrChannels;
+        // Every level is already in the file, no decoding and no glGenerateMipmap
+        const GLint internalFormat = header.sourceChannels == 4 ? GL_RGBA : GL_RGB;
+        for (uint32_t level = 0; level < header.mipCount; ++level)
+        {
+            const auto& mip = baked.getLevel(level);
+            glTexImage2D(GL_TEXTURE_2D, static_cast<GLint>(level), internalFormat, static_cast<GLsizei>(mip.width),
+                         static_cast<GLsizei>(mip.height), 0, GL_RGBA, GL_UNSIGNED_BYTE, baked.getPixels(level));
+        }
+        has_mipmaps = true;
+
+        file_name = name;
+        is_tileset = header.tilesX > 0 && header.tilesY > 0;
+        if (is_tileset)
+        {
+            tile_uvs = generateTileUVs(static_cast<int>(header.tilesX), static_cast<int>(header.tilesY));
+        }
+    }
+
+    bool Texture::parseTileGrid(const std::string& fileName, int& tilesX, int& tilesY)
+    {
+        std::string filename = fileName;
+        std::ranges::transform(filename, filename.begin(), ::tolower);
+        if (filename.find("tileset") == std::string::npos) return false;
+
+        std::smatch match;
+        if (const std::regex tileSizePattern(R"(_(\d+)x(\d+))"); std::regex_search(filename, match, tileSizePattern)
+            && match.size() == 3)
+        {
+            tilesX = std::stoi(match[1].str());
+            tilesY = std::stoi(match[2].str());
+        }
+        return true;
+    }
+
+    ImageData Texture::loadImage(const std::string& path)
+    {
+        ImageData image;
         // Flip image vertically because OpenGL origin is bottom-left, but most image formats store pixel data top-left.
-        stbi_set_flip_vertically_on_load(true);
-        unsigned char* data = stbi_load(resolveAssetPath(path).c_str(), &width, &height, &nrChannels, STBI_rgb_alpha);
+        // The flag is set per thread, so images can be decoded on worker threads.
+        stbi_set_flip_vertically_on_load_thread(true);
+        unsigned char* data = stbi_load(resolveAssetPath(path).c_str(), &image.width, &image.height, &image.channels,
+                                        STBI_rgb_alpha);
         if (!data)
         {
             throw std::runtime_error("Failed to load texture: " + path);
         }
+        image.pixels.assign(data, data + static_cast<size_t>(image.width) * image.height * 4);
+        // Free stb's copy of the image memory.
+        stbi_image_free(data);
+        return image;
+    }
 
-        // Extract the base file name (without extension).
-        const std::filesystem::path file = path;
-        file_name = file.stem().string();
+    Texture::Texture(const int width, const int height, const GLuint unpackBuffer, const std::string& name,
+                     const int tilesX, const int tilesY)
+    {
+        // With a pixel unpack buffer bound, the pixel pointer is an offset into it and the copy happens on the GPU side
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, unpackBuffer);
+        upload(width, height, GL_RGBA, nullptr, false);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        file_name = name;
+        setupTiles(name, tilesX, tilesY);
+    }
+
+    void Texture::upload(const ImageData& image)
+    {
+        // Even if the source is RGB, the pixels are always RGBA.
+        upload(image.width, image.height, image.channels == 4 ? GL_RGBA : GL_RGB, image.pixels.data(), true);
+    }
+
+    void Texture::upload(const int imageWidth, const int imageHeight, const GLint internalFormat, const void* pixels,
+                         const bool mipmaps)
+    {
+        width = imageWidth;
+        height = imageHeight;
+
+        // Generate an OpenGL texture object.
+        glGenTextures(1, &ID);
+        GLStateCache::bindTexture(0, ID);
+
+        // Set wrapping and filtering options
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 
         // Upload texture data to GPU.
-        if (nrChannels == 4)
+        glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+
+        if (mipmaps)
         {
-            glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, data);
+            // Generate mipmaps for better minification.
+            glGenerateMipmap(GL_TEXTURE_2D);
+            has_mipmaps = true;
         }
         else
         {
-            // Even if the source is RGB, always store as RGBA.
-            glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, data);
+            // Keep the texture complete with only level 0 until generateMipmaps() is called
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, 0);
         }
-        // Generate mipmaps for better minification.
+    }
+
+    void Texture::generateMipmaps()
+    {
+        if (has_mipmaps || ID == 0) return;
+
+        GLStateCache::bindTexture(0, ID);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, 1000);
         glGenerateMipmap(GL_TEXTURE_2D);
+        has_mipmaps = true;
+    }
+
+    void Texture::setupTiles(const std::string& name, const int tilesX, const int tilesY)
+    {
         // Detect if this is a tileset based on the filename.
-        std::string filename = std::filesystem::path(path).filename().string();
+        std::string filename = name;
         std::ranges::transform(filename, filename.begin(), ::tolower);
         is_tileset = filename.find("tileset") != std::string::npos;
         // If it's a tileset, precompute UVs for each tile.
         tile_uvs = isTileSet() ? generateTileUVs(tilesX, tilesY) : tile_uvs;
-        // Free CPU-side image memory.
-        stbi_image_free(data);
     }
 
     Texture::~Texture()
     {
         if (ID != 0)
         {
+            GLStateCache::forgetTexture(ID);
             glDeleteTextures(1, &ID);
         }
     }
 
     Texture::Texture(Texture&& other) noexcept
-        : ID(other.ID), width(other.width), height(other.height)
+        : ID(other.ID), width(other.width), height(other.height), has_mipmaps(other.has_mipmaps)
     {
         other.ID = 0;
         other.width = 0;
@@ -81,11 +190,13 @@ namespace gl3::engine::rendering
         {
             if (ID != 0)
             {
+                GLStateCache::forgetTexture(ID);
                 glDeleteTextures(1, &ID);
             }
             ID = other.ID;
             width = other.width;
             height = other.height;
+            has_mipmaps = other.has_mipmaps;
 
             other.ID = 0;
             other.width = 0;
@@ -96,8 +207,7 @@ namespace gl3::engine::rendering
 
     void Texture::bind(const GLuint slot) const
     {
-        glActiveTexture(GL_TEXTURE0 + slot);
-        glBindTexture(GL_TEXTURE_2D, ID);
+        GLStateCache::bindTexture(slot, ID);
     }
 
     glm::vec4 Texture::getTileUV(const int tileX, const int tileY, const int tilesX, const int tilesY)
@@ -0,0 +1,194 @@
+/**
+* @file TextureAtlas.cpp
+ * @brief Implements skyline packing of small images into texture atlas pages.
+ */
+#include "engine/rendering/TextureAtlas.h"
+#include <algorithm>
+#include <climits>
+#include <cstring>
+
+namespace gl3::engine::rendering
+{
+    TextureAtlas::TextureAtlas(const int pageSize, const int padding) : page_size(pageSize), padding(padding)
+    {
+        GLint maxTextureSize = 0;
+        glGetIntegerv(GL_MAX_TEXTURE_SIZE, &maxTextureSize);
+        if (maxTextureSize > 0)
+        {
+            page_size = std::min(page_size, static_cast<int>(maxTextureSize));
+        }
+    }
+
+    bool TextureAtlas::fits(const int width, const int height) const
+    {
+        return width + 2 * padding <= page_size && height + 2 * padding <= page_size;
+    }
+
+    void TextureAtlas::add(const std::string& key, ImageData image, std::vector<glm::vec4> tileUVs)
+    {
+        pending.push_back({key, std::move(image), std::move(tileUVs)});
+    }
+
+    void TextureAtlas::build()
+    {
+        // Tallest first gives a flatter skyline and less wasted space
+        std::ranges::stable_sort(pending, [](const PendingImage& lhs, const PendingImage& rhs)
+        {
+            return lhs.image.height > rhs.image.height;
+        });
+
+        std::vector<PageBuilder> builders;
+        struct Placement
+        {
+            size_t page;
+            int x;
+            int y;
+        };
+        std::vector<Placement> placements;
+        placements.reserve(pending.size());
+
+        for (const auto& image : pending)
+        {
+            const int paddedWidth = image.image.width + 2 * padding;
+            const int paddedHeight = image.image.height + 2 * padding;
+            Placement placement{};
+            bool placed = false;
+            for (size_t i = 0; i < builders.size() && !placed; ++i)
+            {
+                placed = insert(builders[i], paddedWidth, paddedHeight, placement.x, placement.y);
+                placement.page = i;
+            }
+            if (!placed)
+            {
+                PageBuilder& page = builders.emplace_back();
+                page.image.width = page_size;
+                page.image.height = page_size;
+                page.image.pixels.assign(static_cast<size_t>(page_size) * page_size * 4, 0);
+                page.skyline.push_back({0, 0, page_size});
+                placement.page = builders.size() - 1;
+                insert(page, paddedWidth, paddedHeight, placement.x, placement.y);
+            }
+            blit(builders[placement.page].image, image.image, placement.x + padding, placement.y + padding);
+            placements.push_back(placement);
+        }
+
+        pages.clear();
+        for (size_t i = 0; i < builders.size(); ++i)
+        {
+            pages.push_back(std::make_unique<Texture>(builders[i].image, "atlas_" + std::to_string(i)));
+        }
+
+        const auto size = static_cast<float>(page_size);
+        for (size_t i = 0; i < pending.size(); ++i)
+        {
+            auto& image = pending[i];
+            const auto& placement = placements[i];
+            const auto x = static_cast<float>(placement.x + padding);
+            const auto y = static_cast<float>(placement.y + padding);
+
+            TextureRegion region;
+            region.texture = pages[placement.page].get();
+            region.rect = {
+                x / size, y / size,
+                (x + static_cast<float>(image.image.width)) / size, (y + static_cast<float>(image.image.height)) / size
+            };
+            region.width = image.image.width;
+            region.height = image.image.height;
+            region.tileUVs = std::move(image.tileUVs);
+            regions[image.key] = std::move(region);
+        }
+        pending.clear();
+    }
+
+    const TextureRegion* TextureAtlas::find(const std::string& key) const
+    {
+        const auto it = regions.find(key);
+        return it == regions.end() ? nullptr : &it->second;
+    }
+
+    bool TextureAtlas::insert(PageBuilder& page, const int width, const int height, int& outX, int& outY) const
+    {
+        auto& skyline = page.skyline;
+        int bestY = INT_MAX;
+        int bestX = INT_MAX;
+        size_t bestIndex = skyline.size();
+
+        for (size_t i = 0; i < skyline.size(); ++i)
+        {
+            const int x = skyline[i].x;
+            if (x + width > page_size) break;
+
+            // The rect rests on the highest node it spans
+            int y = 0;
+            int remaining = width;
+            for (size_t j = i; remaining > 0; ++j)
+            {
+                y = std::max(y, skyline[j].y);
+                remaining -= skyline[j].width;
+            }
+            if (y + height > page_size) continue;
+
+            if (y < bestY || (y == bestY && x < bestX))
+            {
+                bestY = y;
+                bestX = x;
+                bestIndex = i;
+            }
+        }
+        if (bestIndex == skyline.size()) return false;
+
+        // Raise the skyline under the new rect and cut the nodes it covers
+        skyline.insert(skyline.begin() + static_cast<std::ptrdiff_t>(bestIndex), {bestX, bestY + height, width});
+        const int right = bestX + width;
+        for (size_t i = bestIndex + 1; i < skyline.size();)
+        {
+            auto& node = skyline[i];
+            if (node.x >= right) break;
+            const int overlap = right - node.x;
+            if (node.width <= overlap)
+            {
+                skyline.erase(skyline.begin() + static_cast<std::ptrdiff_t>(i));
+                continue;
+            }
+            node.x += overlap;
+            node.width -= overlap;
+            break;
+        }
+        // Merge neighbours of equal height
+        for (size_t i = 0; i + 1 < skyline.size();)
+        {
+            if (skyline[i].y == skyline[i + 1].y)
+            {
+                skyline[i].width += skyline[i + 1].width;
+                skyline.erase(skyline.begin() + static_cast<std::ptrdiff_t>(i + 1));
+                continue;
+            }
+            ++i;
+        }
+
+        outX = bestX;
+        outY = bestY;
+        return true;
+    }
+
+    void TextureAtlas::blit(ImageData& page, const ImageData& image, const int x, const int y) const
+    {
+        const size_t pageStride = static_cast<size_t>(page.width) * 4;
+        const size_t imageStride = static_cast<size_t>(image.width) * 4;
+
+        for (int row = -padding; row < image.height + padding; ++row)
+        {
+            const int sourceRow = std::clamp(row, 0, image.height - 1);
+            unsigned char* destination = page.pixels.data() + (y + row) * pageStride + static_cast<size_t>(x) * 4;
+            const unsigned char* source = image.pixels.data() + sourceRow * imageStride;
+
+            std::memcpy(destination, source, imageStride);
+            // Extrude the left and right edge pixels
+            for (int column = 1; column <= padding; ++column)
+            {
+                std::memcpy(destination - column * 4, source, 4);
+                std::memcpy(destination + imageStride + (column - 1) * 4, source + imageStride - 4, 4);
+            }
+        }
+    }
+}
@@ -1,8 +1,8 @@
 #include "engine/rendering/TextureManager.h"
 #include "engine/Assets.h"
 
+#include <algorithm>
 #include <iostream>
-#include <regex>
 #include <stdexcept>
 #include <unordered_set>
 
@@ -13,12 +13,12 @@ namespace gl3::engine::rendering
      *
      * Maps texture names to their unique Texture instances.
      */
-    std::unordered_map<std::string, std::unique_ptr<Texture>> TextureManager::texture_cache;
+    std::unordered_map<std::string, TextureRegion> TextureManager::texture_cache;
 
     /**
      * @brief Cache for loaded tile set textures.
      */
-    std::unordered_map<std::string, std::unique_ptr<Texture>> TextureManager::tile_set_cache;
+    std::unordered_map<std::string, TextureRegion> TextureManager::tile_set_cache;
 
     /**
      * @brief Cache for loaded UI textures.
@@ -30,6 +30,20 @@ namespace gl3::engine::rendering
      */
     std::unordered_map<std::string, std::unique_ptr<Texture>> TextureManager::bg_texture_cache;
 
+    std::unique_ptr<TextureAtlas> TextureManager::atlas;
+    bool TextureManager::atlas_built = false;
+    std::vector<std::unique_ptr<Texture>> TextureManager::standalone_textures;
+    std::unordered_map<std::string, TextureRegion> TextureManager::bg_region_cache;
+    std::unordered_set<std::string> TextureManager::pending_atlas_keys;
+
+    std::unique_ptr<TextureStreamer> TextureManager::streamer;
+    std::unordered_map<std::string, TextureManager::TextureSource> TextureManager::pending_sources;
+    size_t TextureManager::pending_level_textures = 0;
+    std::vector<Texture*> TextureManager::mipmap_queue;
+    size_t TextureManager::load_total = 0;
+    size_t TextureManager::load_done = 0;
+    events::Event<TextureManager, size_t, size_t> TextureManager::onLoadProgress;
+
     /**
      * @brief Valid file extensions for texture loading.
      *
@@ -37,20 +51,21 @@ namespace gl3::engine::rendering
      */
     static const std::unordered_set<std::string> validExtensions = {".png", ".jpg", ".jpeg"};
 
-    void TextureManager::add(const std::string& key, const std::filesystem::path& path, int tilesX, int tilesY)
+    bool TextureManager::shouldLoad(const std::string& key, const std::filesystem::path& path)
     {
         if (!exists(path) || !is_regular_file(path) || !validExtensions.contains(path.extension().string()))
         {
             std::cerr << "Texture path is invalid: " << path << std::endl;
-            return;
+            return false;
         }
 
-        if (texture_cache.contains(key) || tile_set_cache.contains(key) ||
-            ui_texture_cache.contains(key) || bg_texture_cache.contains(key))
-        {
-            return;
-        }
+        return !texture_cache.contains(key) && !tile_set_cache.contains(key) &&
+            !ui_texture_cache.contains(key) && !bg_texture_cache.contains(key) &&
+            !pending_atlas_keys.contains(key) && !pending_sources.contains(key);
+    }
 
+    TextureManager::TextureSource TextureManager::classify(const std::filesystem::path& path, int tilesX, int tilesY)
+    {
         std::string filename = path.filename().string();
         std::ranges::transform(filename, filename.begin(), ::tolower);
 
@@ -59,44 +74,284 @@ namespace gl3::engine::rendering
 
         if (parent.find("ui") != std::string::npos)
         {
-            ui_texture_cache.emplace(key, std::make_unique<Texture>(path.string()));
-            return;
+            return {TextureKind::UI, filename};
         }
 
         if (parent.find("background") != std::string::npos)
         {
-            bg_texture_cache.emplace(key, std::make_unique<Texture>(path.string()));
+            return {TextureKind::Background, filename};
+        }
+
+        if (Texture::parseTileGrid(filename, tilesX, tilesY))
+        {
+            return {TextureKind::TileSet, filename, tilesX, tilesY};
+        }
+        return {TextureKind::Texture, filename, tilesX, tilesY};
+    }
+
+    void TextureManager::add(const std::string& key, const std::filesystem::path& path, const int tilesX,
+                             const int tilesY)
+    {
+        if (!shouldLoad(key, path)) return;
+
+        // Prefer the pre-decoded bake, the image file is the fallback
+        if (const auto baked = TextureStreamer::openBaked(path))
+        {
+            insert(key, classify(path, tilesX, tilesY), {}, false, baked.get());
             return;
         }
+        insert(key, classify(path, tilesX, tilesY), Texture::loadImage(path.string()), false);
+    }
 
-        if (filename.find("tileset") != std::string::npos)
+    void TextureManager::insert(const std::string& key, const TextureSource& source, ImageData image,
+                                const bool deferMipmaps, const BakedTexture* baked)
+    {
+        const auto createTexture = [&](const int tilesX, const int tilesY)
         {
-            std::smatch match;
+            if (baked)
+            {
+                // All mip levels come from the bake, nothing to defer
+                return std::make_unique<Texture>(*baked, source.fileName);
+            }
+            if (!deferMipmaps || !streamer)
+            {
+                return std::make_unique<Texture>(image, source.fileName, tilesX, tilesY);
+            }
+            auto texture = streamer->upload(image, source.fileName, tilesX, tilesY);
+            mipmap_queue.push_back(texture.get());
+            return texture;
+        };
 
-            if (const std::regex tileSizePattern(R"(_(\d+)x(\d+))"); std::regex_search(filename, match, tileSizePattern)
-                && match.size() == 3)
+        switch (source.kind)
+        {
+        case TextureKind::UI:
+            ui_texture_cache.emplace(key, createTexture(0, 0));
+            return;
+        case TextureKind::Background:
             {
-                tilesX = std::stoi(match[1].str());
-                tilesY = std::stoi(match[2].str());
+                const auto& texture = *bg_texture_cache.emplace(key, createTexture(0, 0)).first->second;
+                bg_region_cache.emplace(key, makeRegion(texture));
+                return;
             }
+        default:
+            break;
+        }
 
-            tile_set_cache.emplace(key, std::make_unique<Texture>(path.string(), tilesX, tilesY));
+        const bool isTileSet = source.kind == TextureKind::TileSet;
+        int tilesX = source.tilesX;
+        int tilesY = source.tilesY;
+        int width = image.width;
+        int height = image.height;
+        if (baked)
+        {
+            // The baker stored the tile grid, no need to parse the file name again
+            const auto& header = baked->getHeader();
+            if (isTileSet && header.tilesX > 0 && header.tilesY > 0)
+            {
+                tilesX = static_cast<int>(header.tilesX);
+                tilesY = static_cast<int>(header.tilesY);
+            }
+            width = static_cast<int>(header.width);
+            height = static_cast<int>(header.height);
         }
-        else
+
+        if (!atlas_built && width <= maxAtlasImageSize && height <= maxAtlasImageSize)
+        {
+            if (!atlas)
+            {
+                atlas = std::make_unique<TextureAtlas>();
+            }
+            if (atlas->fits(width, height))
+            {
+                if (baked)
+                {
+                    image = baked->toImage();
+                }
+                // The cache entry is created by buildAtlas()
+                auto tileUVs = isTileSet
+                                   ? Texture::generateTileUVs(tilesX, tilesY)
+                                   : std::vector<glm::vec4>{};
+                atlas->add(key, std::move(image), std::move(tileUVs));
+                pending_atlas_keys.insert(key);
+                return;
+            }
+        }
+
+        standalone_textures.push_back(createTexture(tilesX, tilesY));
+        auto& cache = isTileSet ? tile_set_cache : texture_cache;
+        cache.emplace(key, makeRegion(*standalone_textures.back()));
+    }
+
+    TextureRegion TextureManager::makeRegion(const Texture& texture)
+    {
+        TextureRegion region;
+        region.texture = &texture;
+        region.width = texture.getWidth();
+        region.height = texture.getHeight();
+        region.tileUVs = texture.getTileUVs();
+        return region;
+    }
+
+    void TextureManager::buildAtlas()
+    {
+        atlas_built = true;
+        if (!atlas) return;
+
+        atlas->build();
+        for (const auto& [key, packed] : atlas->getRegions())
         {
-            texture_cache.emplace(key, std::make_unique<Texture>(path.string()));
+            auto& cache = packed.isTileSet() ? tile_set_cache : texture_cache;
+            cache.insert_or_assign(key, packed);
         }
+        pending_atlas_keys.clear();
+        std::cout << "TextureManager: packed " << atlas->getRegions().size() << " textures into "
+            << atlas->getPages().size() << " atlas page(s)" << std::endl;
     }
 
 
     void TextureManager::loadTextures()
     {
-        const std::filesystem::path textureFolder = resolveAssetPath("textures");
-        addAllTexturesFromFolder(textureFolder);
-        const std::filesystem::path uiTextureFolder = resolveAssetPath("uiTextures");
-        addAllTexturesFromFolder(uiTextureFolder);
-        const std::filesystem::path bgTextureFolder = resolveAssetPath("backgroundTextures");
-        addAllTexturesFromFolder(bgTextureFolder);
+        loadTexturesAsync();
+        finishLoading();
+    }
+
+    void TextureManager::loadTexturesAsync()
+    {
+        if (!streamer)
+        {
+            streamer = std::make_unique<TextureStreamer>();
+        }
+
+        // UI textures first, so the level select screen can show up while the level textures are still decoding
+        for (const auto* folder : {"uiTextures", "textures", "backgroundTextures"})
+        {
+            for (const auto& entry : std::filesystem::directory_iterator(resolveAssetPath(folder)))
+            {
+                const std::string key = entry.path().stem().string();
+                if (!entry.is_regular_file() || !shouldLoad(key, entry.path())) continue;
+
+                const TextureSource source = classify(entry.path(), 8, 8);
+                if (source.kind == TextureKind::Texture || source.kind == TextureKind::TileSet)
+                {
+                    ++pending_level_textures;
+                }
+                pending_sources.emplace(key, source);
+                streamer->enqueue({key, entry.path()});
+                ++load_total;
+            }
+        }
+        endLoadingIfDone();
+    }
+
+    void TextureManager::update(const size_t uploadBudget)
+    {
+        // Mipmaps of last frame's uploads, the pixel transfers had a frame to finish meanwhile
+        for (auto* texture : mipmap_queue)
+        {
+            texture->generateMipmaps();
+        }
+        mipmap_queue.clear();
+
+        if (!streamer) return;
+
+        for (size_t uploaded = 0; uploaded < uploadBudget; ++uploaded)
+        {
+            auto result = streamer->poll();
+            if (!result) break;
+            finalize(std::move(*result), true);
+        }
+        endLoadingIfDone();
+    }
+
+    void TextureManager::finishLoading()
+    {
+        while (!pending_sources.empty())
+        {
+            finishPending(pending_sources.begin()->first);
+        }
+        endLoadingIfDone();
+        for (auto* texture : mipmap_queue)
+        {
+            texture->generateMipmaps();
+        }
+        mipmap_queue.clear();
+    }
+
+    void TextureManager::finalize(TextureStreamer::Result result, const bool deferMipmaps)
+    {
+        const auto pending = pending_sources.find(result.request.key);
+        if (pending == pending_sources.end()) return;
+
+        const TextureSource source = pending->second;
+        pending_sources.erase(pending);
+        if (source.kind == TextureKind::Texture || source.kind == TextureKind::TileSet)
+        {
+            --pending_level_textures;
+        }
+
+        if (!result.error.empty())
+        {
+            std::cerr << "TextureManager: " << result.error << std::endl;
+        }
+        else
+        {
+            insert(result.request.key, source, std::move(result.image), deferMipmaps, result.baked.get());
+        }
+
+        ++load_done;
+        onLoadProgress.invoke(load_done, load_total);
+    }
+
+    void TextureManager::finishPending(const std::string& key)
+    {
+        if (!streamer || !pending_sources.contains(key)) return;
+
+        if (auto result = streamer->wait(key))
+        {
+            finalize(std::move(*result), false);
+        }
+        else
+        {
+            // Lost by the streamer, don't wait for it forever
+            std::cerr << "TextureManager: Texture was queued but never decoded: " << key << std::endl;
+            if (const auto kind = pending_sources.at(key).kind;
+                kind == TextureKind::Texture || kind == TextureKind::TileSet)
+            {
+                --pending_level_textures;
+            }
+            pending_sources.erase(key);
+        }
+    }
+
+    void TextureManager::finishLevelTextures()
+    {
+        while (pending_level_textures > 0)
+        {
+            const auto level = std::ranges::find_if(pending_sources, [](const auto& pending)
+            {
+                return pending.second.kind == TextureKind::Texture || pending.second.kind == TextureKind::TileSet;
+            });
+            if (level == pending_sources.end()) break;
+            finishPending(level->first);
+        }
+        if (!atlas_built)
+        {
+            buildAtlas();
+        }
+    }
+
+    void TextureManager::endLoadingIfDone()
+    {
+        if (!streamer) return;
+
+        if (!atlas_built && pending_level_textures == 0)
+        {
+            buildAtlas();
+        }
+        if (pending_sources.empty())
+        {
+            streamer.reset();
+        }
     }
 
     void TextureManager::addAllTexturesFromFolder(const std::filesystem::path& textureFolderPath)
@@ -117,26 +372,34 @@ namespace gl3::engine::rendering
         }
     }
 
-    const Texture* TextureManager::getTileOrSingleTex(const std::string& key)
+    const TextureRegion* TextureManager::getTileOrSingleTex(const std::string& key)
     {
+        // Level textures may live in the atlas, which is only complete once all of them are decoded
+        if (streamer && (pending_level_textures > 0 || !atlas_built))
+        {
+            finishLevelTextures();
+        }
+        finishPending(key);
+
         auto tex = texture_cache.find(key);
         if (tex == texture_cache.end())
         {
             tex = tile_set_cache.find((key));
             if (tex == tile_set_cache.end())
             {
-                tex = bg_texture_cache.find((key));
-                if (tex == bg_texture_cache.end())
+                tex = bg_region_cache.find((key));
+                if (tex == bg_region_cache.end())
                 {
                     throw std::runtime_error("TextureManager: Texture key not found: " + key);
                 }
             }
         }
-        return tex->second.get();
+        return &tex->second;
     }
 
     const Texture* TextureManager::getUITexture(const std::string& key)
     {
+        finishPending(key);
         const auto tex = ui_texture_cache.find(key);
         if (tex == ui_texture_cache.end())
         {
@@ -147,6 +410,7 @@ namespace gl3::engine::rendering
 
     const Texture* TextureManager::getBgTexture(const std::string& key)
     {
+        finishPending(key);
         const auto tex = bg_texture_cache.find(key);
         if (tex == bg_texture_cache.end())
         {
@@ -163,9 +427,22 @@ namespace gl3::engine::rendering
 
     void TextureManager::clear()
     {
+        // Stop the workers before the caches go away
+        streamer.reset();
+        pending_sources.clear();
+        pending_level_textures = 0;
+        mipmap_queue.clear();
+        load_total = 0;
+        load_done = 0;
+
         texture_cache.clear();
         tile_set_cache.clear();
         ui_texture_cache.clear();
         bg_texture_cache.clear();
+        bg_region_cache.clear();
+        pending_atlas_keys.clear();
+        standalone_textures.clear();
+        atlas.reset();
+        atlas_built = false;
     }
 }
@@ -0,0 +1,185 @@
+/**
+* @file TextureStreamer.cpp
+ * @brief Implements parallel image decoding and pixel unpack buffer uploads.
+ */
+#include "engine/rendering/TextureStreamer.h"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+
+namespace gl3::engine::rendering
+{
+    TextureStreamer::TextureStreamer(unsigned workerCount)
+    {
+        if (workerCount == 0)
+        {
+            // Leave one hardware thread for the main thread, which keeps rendering meanwhile
+            workerCount = std::max(2u, std::thread::hardware_concurrency()) - 1;
+        }
+        workers.reserve(workerCount);
+        for (unsigned i = 0; i < workerCount; ++i)
+        {
+            workers.emplace_back([this](const std::stop_token& stopToken) { work(stopToken); });
+        }
+    }
+
+    TextureStreamer::~TextureStreamer()
+    {
+        {
+            std::lock_guard lock(mutex);
+            queue.clear();
+        }
+        for (auto& worker : workers)
+        {
+            worker.request_stop();
+        }
+        queued_cv.notify_all();
+        workers.clear();
+
+        if (unpack_buffers[0] != 0)
+        {
+            glDeleteBuffers(static_cast<GLsizei>(unpackBufferCount), unpack_buffers);
+        }
+    }
+
+    void TextureStreamer::enqueue(Request request)
+    {
+        {
+            std::lock_guard lock(mutex);
+            queue.push_back(std::move(request));
+        }
+        queued_cv.notify_one();
+    }
+
+    std::optional<TextureStreamer::Result> TextureStreamer::poll()
+    {
+        std::lock_guard lock(mutex);
+        if (finished.empty()) return std::nullopt;
+
+        Result result = std::move(finished.front());
+        finished.pop_front();
+        return result;
+    }
+
+    std::optional<TextureStreamer::Result> TextureStreamer::wait(const std::string& key)
+    {
+        std::unique_lock lock(mutex);
+
+        // Not picked up yet: decoding it here is faster than waiting for a free worker
+        if (const auto queued = std::ranges::find(queue, key, &Request::key); queued != queue.end())
+        {
+            Request request = std::move(*queued);
+            queue.erase(queued);
+            lock.unlock();
+            return decode(std::move(request));
+        }
+
+        const auto isFinished = [&]
+        {
+            return std::ranges::find(finished, key, [](const Result& result) { return result.request.key; }) !=
+                finished.end();
+        };
+        finished_cv.wait(lock, [&]
+        {
+            return isFinished() || std::ranges::find(in_flight, key) == in_flight.end();
+        });
+
+        const auto done = std::ranges::find(finished, key, [](const Result& result) { return result.request.key; });
+        if (done == finished.end()) return std::nullopt;
+
+        Result result = std::move(*done);
+        finished.erase(done);
+        return result;
+    }
+
+    size_t TextureStreamer::getOutstandingCount() const
+    {
+        std::lock_guard lock(mutex);
+        return queue.size() + in_flight.size() + finished.size();
+    }
+
+    std::unique_ptr<Texture> TextureStreamer::upload(const ImageData& image, const std::string& name, const int tilesX,
+                                                     const int tilesY)
+    {
+        if (unpack_buffers[0] == 0)
+        {
+            glGenBuffers(static_cast<GLsizei>(unpackBufferCount), unpack_buffers);
+        }
+        const GLuint buffer = unpack_buffers[next_unpack_buffer];
+        next_unpack_buffer = (next_unpack_buffer + 1) % unpackBufferCount;
+
+        const auto size = static_cast<GLsizeiptr>(image.pixels.size());
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer);
+        // Orphan the old storage instead of waiting for a transfer that may still read from it
+        glBufferData(GL_PIXEL_UNPACK_BUFFER, size, nullptr, GL_STREAM_DRAW);
+        if (void* mapped = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, size,
+                                            GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT))
+        {
+            std::memcpy(mapped, image.pixels.data(), image.pixels.size());
+            glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+        }
+        else
+        {
+            glBufferSubData(GL_PIXEL_UNPACK_BUFFER, 0, size, image.pixels.data());
+        }
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+        return std::make_unique<Texture>(image.width, image.height, buffer, name, tilesX, tilesY);
+    }
+
+    void TextureStreamer::work(const std::stop_token& stopToken)
+    {
+        while (!stopToken.stop_requested())
+        {
+            Request request;
+            {
+                std::unique_lock lock(mutex);
+                if (!queued_cv.wait(lock, stopToken, [&] { return !queue.empty(); })) return;
+
+                request = std::move(queue.front());
+                queue.pop_front();
+                in_flight.push_back(request.key);
+            }
+
+            Result result = decode(std::move(request));
+
+            {
+                std::lock_guard lock(mutex);
+                std::erase(in_flight, result.request.key);
+                finished.push_back(std::move(result));
+            }
+            finished_cv.notify_all();
+        }
+    }
+
+    std::unique_ptr<BakedTexture> TextureStreamer::openBaked(const std::filesystem::path& imagePath)
+    {
+        try
+        {
+            return BakedTexture::openFor(imagePath);
+        }
+        catch (const std::exception& e)
+        {
+            std::cerr << e.what() << ", decoding the image instead" << std::endl;
+            return nullptr;
+        }
+    }
+
+    TextureStreamer::Result TextureStreamer::decode(Request request)
+    {
+        Result result{std::move(request), {}, nullptr, {}};
+        result.baked = openBaked(result.request.path);
+        if (result.baked) return result;
+
+        try
+        {
+            result.image = Texture::loadImage(result.request.path.string());
+        }
+        catch (const std::exception& e)
+        {
+            result.error = e.what();
+        }
+        return result;
+    }
+}
@@ -6,18 +6,23 @@
 #include "GameStateManager.h"
 #include "engine/audio/AudioSystem.h"
 #include "engine/ecs/EntityFactory.h"
+#include "engine/Assets.h"
+#include "engine/rendering/ShaderCache.h"
 #include "engine/levelLoading/LevelCreationUI.h"
 #include "ui/FinishUI.h"
 #include "ui/InGameMenuUI.h"
 #include "ui/InstructionUI.h"
+#include "ui/LoadingUI.h"
 
 namespace gl3::game
 {
     Game::Game(const int width, const int height, const std::string& title, const glm::vec3& camPos,
-               const float camZoom)
-        : engine::Game(width, height, title, camPos, camZoom), game_state_manager(new GameStateManager(*this)),
+               const float camZoom, const unsigned physicsWorkers)
+        : engine::Game(width, height, title, camPos, camZoom, physicsWorkers), game_state_manager(new GameStateManager(*this)),
           player_input_system(new input::PlayerInputSystem(*this))
     {
+        //reuse linked shader programs from previous runs instead of compiling them again
+        engine::rendering::ShaderCache::enableProgramBinaryCache(engine::getExecutablePath().parent_path() / "shaderCache");
     }
 
     ///Update needed custom systems each frame (here: PlayerInputSystem) and check if player is still in view
@@ -45,6 +50,7 @@ namespace gl3::game
         ui_system->registerSubsystem<ui::InGameMenuUI>();
         ui_system->registerSubsystem<ui::InstructionUI>();
         ui_system->registerSubsystem<ui::FinishUI>();
+        ui_system->registerSubsystem<ui::LoadingUI>();
         ui_system->registerSubsystem<engine::editor::EditorUISystem>();
         ui_system->registerSubsystem<engine::levelLoading::LevelCreationUISystem>();
     }
@@ -26,8 +26,10 @@ namespace gl3::game
    * @param title Window title string.
    * @param camPos Initial camera position.
    * @param camZoom Initial camera zoom level.
+   * @param physicsWorkers Number of threads stepping the physics world, 0 uses all hardware threads.
    */
-  Game(int width, int height, const std::string& title, const glm::vec3& camPos, float camZoom);
+  Game(int width, int height, const std::string& title, const glm::vec3& camPos, float camZoom,
+       unsigned physicsWorkers = 0);
 
   /**
    * @brief Retrieves the player input system.
@@ -1,4 +1,5 @@
 #include "PlayerInputSystem.h"
+#include <algorithm>
 #include "engine/audio/AudioSystem.h"
 #include "engine/ecs/EntityFactory.h"
 #include "engine/levelloading/LevelManager.h"
@@ -37,14 +38,12 @@ namespace gl3::game::input
             space_pressed = false;
         }
 
-        const float fixedX = game.getRegistry().get<engine::ecs::TransformComponent>(game.getPlayer()).initialPosition
-                                 .x;
-        b2Vec2 pos = b2Body_GetPosition(body);
-        pos.x = fixedX;
-        b2Body_SetTransform(body, pos, b2Body_GetRotation(body));
-
+        const float fixedX = game.getRegistry().get<engine::ecs::InitialTransformComponent>(game.getPlayer()).position.x;
         b2Vec2 vel = b2Body_GetLinearVelocity(body);
-        vel.x = 0.0f;
+        // Run with the camera, so contacts with the static level get a real relative velocity. Distance lost to
+        // impulses resetting the velocity is caught up, a blocked player still falls behind and out of view.
+        const float lag = fixedX + scroll_distance - b2Body_GetPosition(body).x;
+        vel.x = curr_lvl_speed + std::clamp(lag * catch_up_rate, -curr_lvl_speed, curr_lvl_speed);
         b2Body_SetLinearVelocity(body, vel);
 
         if (engine::physics::PlayerContactListener::playerGrounded)
@@ -121,6 +120,7 @@ namespace gl3::game::input
         previousGravityChanger = b2_nullShapeId;
         can_jump = true;
         space_pressed = false;
+        scroll_distance = 0.f;
 
         b2World_SetGravity(game.getPhysicsWorld(), b2Vec2(0.0f, -10.0f));
     }
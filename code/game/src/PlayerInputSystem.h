@@ -59,6 +59,13 @@ namespace gl3::game::input
          */
         void update();
 
+        /**
+         * @brief Set how far the camera has scrolled since the level start, the player is kept that far ahead of its
+         * initial position.
+         * @param distance The scrolled distance in meters.
+         */
+        void setScrollDistance(const float distance) { scroll_distance = distance; }
+
     private:
         /**
          * @brief Handles adjustments when the level length is computed.
@@ -94,5 +101,7 @@ namespace gl3::game::input
         float y_gravity_multiplier = -1.f; ///< Controls y gravity.
         float targetRotation = 0.0f; ///< The rotation the player should always come back to.
         b2ShapeId previousGravityChanger = b2_nullShapeId; ///< Save the shapeID of the previously hit gravity change object, to not react to it twice!
+        float scroll_distance = 0.f; ///< Distance the camera scrolled since the level start.
+        float catch_up_rate = 10.f; ///< How fast (1/s) the player catches up on distance lost to velocity resets.
     };
 } // gl3
@@ -15,7 +15,8 @@ int main()
             0, // Window height
             "ElectronXPulse", // Window title
             glm::vec3(0.0f, 0.0f, 1.0f), // Initial camera position
-            1.0 / 100.f // Camera zoom standard value
+            1.0 / 100.f, // Camera zoom standard value
+            0 // Physics worker threads -> 0 for one per hardware thread
         );
 
         /// Run the main game loop. (Could call start() before this, but don't need to)
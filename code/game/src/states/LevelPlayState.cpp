@@ -25,24 +25,20 @@ namespace gl3::game::state
         const auto bgConfig = getBackgroundSizes(windowBounds);
         auto& registry = game.getRegistry();
 
-        for (const auto entities = registry.view<engine::ecs::TransformComponent, engine::ecs::TagComponent>(); auto
-             entity : entities)
+        // Runs every frame while the camera scrolls, so only the few window filling entities are visited. They are
+        // visual only, the ground's collider spans the whole level, see createGroundCollider
+        for (const auto entity : background_entities)
         {
-            if (auto tag = entities.get<engine::ecs::TagComponent>(entity).tag; tag == "ground")
-            {
-                engine::ecs::EntityFactory::setPosition(registry, entity, {
-                                                            bgConfig.centerX, bgConfig.groundCenterY, 0.f
-                                                        });
-                engine::ecs::EntityFactory::setScale(registry, entity, {
-                                                         bgConfig.windowWidth, bgConfig.groundHeight, 1.f
-                                                     });
-            }
-            else if (tag == "background" || tag == "sky")
+            if (!registry.valid(entity)) continue;
+            const bool isGround = registry.all_of<engine::ecs::GroundTag>(entity);
+            registry.patch<engine::ecs::TransformComponent>(entity, [&](auto& transform)
             {
-                auto& transform = registry.get<engine::ecs::TransformComponent>(entity);
-                transform.position = {bgConfig.centerX, bgConfig.skyCenterY, 0.f};
-                transform.scale = {bgConfig.windowWidth, bgConfig.skyHeight, 1.f};
-            }
+                transform.position = {bgConfig.centerX, isGround ? bgConfig.groundCenterY : bgConfig.skyCenterY, 0.f};
+                transform.previousPosition = transform.position;
+                transform.scale = {
+                    bgConfig.windowWidth, isGround ? bgConfig.groundHeight : bgConfig.skyHeight, 1.f
+                };
+            });
         }
     }
 
@@ -77,7 +73,7 @@ namespace gl3::game::state
     /**create sky entity with color gradient.
      */
     void LevelPlayState::createSkyGradientEntity(const LevelBackgroundConfig& bgConfig, entt::registry& registry,
-                                                 const b2WorldId physicsWorld) const
+                                                 const b2WorldId physicsWorld)
     {
         //no need to make a gradient if both colors are the same
         if (all(epsilonEqual(current_level->gradientBottomColor, current_level->gradientTopColor, 0.001f))) return;
@@ -91,114 +87,185 @@ namespace gl3::game::state
         sky.position = {bgConfig.centerX, bgConfig.skyCenterY, 0.f};
         sky.scale = {bgConfig.windowWidth, bgConfig.skyHeight, 0.1f};
         sky.zLayer = -10;
-        engine::ecs::EntityFactory::createDefaultEntity(sky, registry, physicsWorld);
+        background_entities.push_back(engine::ecs::EntityFactory::createDefaultEntity(sky, registry, physicsWorld));
     }
 
     /**
-     * Creates background entities for level.
+     * Creates background entities for level. They are visual only, a ground asking for physics gets its collider from
+     * @ref createGroundCollider once the level length is known.
      * @param bgConfig The config with the background sizes
      * @param registry The current enTT registry
      * @param physicsWorld The current Box2D physics world
      */
     void LevelPlayState::createBackgroundEntities(const LevelBackgroundConfig& bgConfig, entt::registry& registry,
-                                                  const b2WorldId physicsWorld) const
+                                                  const b2WorldId physicsWorld)
     {
+        has_ground_collider = false;
         for (auto& object : current_level->backgrounds)
         {
             if (object.tag == "ground")
             {
                 object.position = {bgConfig.centerX, bgConfig.groundCenterY, 0.f};
                 object.scale = {bgConfig.windowWidth, bgConfig.groundHeight, 0.1f};
+                has_ground_collider = has_ground_collider || object.generatePhysicsComp;
             }
             else
             {
                 object.position = {bgConfig.centerX, bgConfig.skyCenterY, 0.f};
                 object.scale = {bgConfig.windowWidth, bgConfig.skyHeight, 0.1f};
             }
-            engine::ecs::EntityFactory::createDefaultEntity(
-                object, registry, physicsWorld);
+            GameObject visual = object;
+            visual.generatePhysicsComp = false;
+            background_entities.push_back(engine::ecs::EntityFactory::createDefaultEntity(
+                visual, registry, physicsWorld));
         }
     }
 
     /**
-     * Creates grouped entities and their physics parent.
+     * Creates one static, invisible ground body below groundLevel, reaching from the start window past the level end.
+     * It never moves, so scrolling the camera does not touch the physics world.
+     * @param registry The current enTT registry
+     * @param physicsWorld The current Box2D physics world
+     */
+    void LevelPlayState::createGroundCollider(entt::registry& registry, const b2WorldId physicsWorld) const
+    {
+        if (!has_ground_collider) return;
+        const auto bgConfig = getBackgroundSizes(game.getContext().getWorldWindowBounds());
+        // One window of margin past the level end, the player keeps running while the finish screen comes up
+        const float left = bgConfig.centerX - bgConfig.windowWidth * 0.5f;
+        const float width = current_level->levelLength + bgConfig.windowWidth * 2.f;
+
+        GameObject ground = {};
+        ground.tag = "ground";
+        ground.generateRenderComp = false;
+        ground.position = {left + width * 0.5f, bgConfig.groundCenterY, 0.f};
+        ground.scale = {width, bgConfig.groundHeight, 0.1f};
+        engine::ecs::EntityFactory::createDefaultEntity(ground, registry, physicsWorld);
+    }
+
+    /**
+     * Creates one group of entities and their physics parent.
+     * @param group The group to instantiate
      * @param registry The current enTT registry
      * @param physicsWorld The current Box2D physics world
      */
-    void LevelPlayState::createGroupedEntities(entt::registry& registry, const b2WorldId physicsWorld) const
+    void LevelPlayState::createGroupedEntity(GameObjectGroup& group, entt::registry& registry,
+                                             const b2WorldId physicsWorld) const
     {
-        for (auto& objGroups = current_level->groups; auto& [ID, children, parent] : objGroups)
+        auto& [ID, children, parent] = group;
+        if (children.empty()) return;
+
+        auto& bodyStreamer = game.getPhysicsSystem()->getBodyStreamer();
+        const auto current_parent_entity = createLevelEntity(parent, registry, physicsWorld);
+        // A streamed parent gets its body and the children's shapes once it comes near the camera
+        const auto* parentPhysics = registry.try_get<engine::ecs::PhysicsComponent>(current_parent_entity);
+        auto current_parent_body_id = parentPhysics ? parentPhysics->body : b2_nullBodyId;
+        registry.emplace<engine::ecs::PhysicsGroupParent>(current_parent_entity, current_parent_body_id, 0);
+
+        for (auto& child : children)
         {
-            if (children.empty())return;
-
-            const auto current_parent_entity = engine::ecs::EntityFactory::createDefaultEntity(
-                parent, registry, physicsWorld);
-            auto current_parent_body_id = registry.get<engine::ecs::PhysicsComponent>(current_parent_entity).body;
-            registry.emplace<engine::ecs::PhysicsGroupParent>(current_parent_entity, current_parent_body_id, 0);
-#
-            for (auto& child : children)
+            auto entity = engine::ecs::EntityFactory::createDefaultEntity(child, registry, physicsWorld);
+            const auto parentPos = registry.get<engine::ecs::TransformComponent>(current_parent_entity).position;
+            glm::vec2 localOffset = {
+                child.position.x - parentPos.x,
+                child.position.y - parentPos.y
+            };
+
+            // Create a shape for this child entity
+            b2ShapeId shapeId = b2_nullShapeId;
+            if (parentPhysics)
             {
-                auto entity = engine::ecs::EntityFactory::createDefaultEntity(child, registry, physicsWorld);
-                const auto parentPos = registry.get<engine::ecs::TransformComponent>(current_parent_entity).position;
-                glm::vec2 localOffset = {
-                    child.position.x - parentPos.x,
-                    child.position.y - parentPos.y
-                };
+                shapeId = engine::ecs::EntityFactory::createGroupChildShape(
+                    current_parent_body_id, entity, registry.get<engine::ecs::TagComponent>(entity).id,
+                    localOffset, child.scale, child.zRotation);
+            }
 
-                // Create a shape for this child entity
-                const b2ShapeDef shapeDef = b2DefaultShapeDef();
-                const b2Polygon polygon = b2MakeOffsetBox(
-                    child.scale.x * 0.5f,
-                    child.scale.y * 0.5f,
-                    {localOffset.x, localOffset.y},
-                    b2MakeRot(child.zRotation)
-                );
-                b2ShapeId shapeId = b2CreatePolygonShape(current_parent_body_id, &shapeDef, &polygon);
-
-                // Attach ECS PhysicsGroup linking child to parent
-                registry.emplace<engine::ecs::PhysicsGroupChild>(entity, current_parent_entity, localOffset, shapeId);
-
-                // Increment the parent’s child count
-                registry.patch<engine::ecs::PhysicsGroupParent>(current_parent_entity, [](auto& pgp)
-                {
-                    ++pgp.childCount;
-                    ++pgp.visibleChildren;
-                });
+            // Attach ECS PhysicsGroup linking child to parent
+            registry.emplace<engine::ecs::PhysicsGroupChild>(entity, current_parent_entity, localOffset, shapeId);
+            if (!parentPhysics)
+            {
+                bodyStreamer.addChild(registry, current_parent_entity, entity);
             }
+
+            // Register the child with its parent
+            registry.patch<engine::ecs::PhysicsGroupParent>(current_parent_entity, [entity](auto& pgp)
+            {
+                pgp.children.push_back(entity);
+                ++pgp.childCount;
+                ++pgp.visibleChildren;
+            });
         }
     }
 
     /**
-     * Creates all single entities.
+     * Creates a single entity.
+     * @param object The GameObject to create the entity from
      * @param registry The current enTT registry
      * @param physicsWorld The current Box2D physics world
      */
-    void LevelPlayState::createSingleEntities(entt::registry& registry, const b2WorldId physicsWorld)
+    void LevelPlayState::createSingleEntity(GameObject& object, entt::registry& registry, const b2WorldId physicsWorld)
     {
-        for (auto& object : current_level->objects)
+        const auto& entity = createLevelEntity(object, registry, physicsWorld);
+        if (object.tag == "player") current_player = entity;
+        game.setPlayer(current_player);
+    }
+
+    /**
+     * Creates an entity of the level. Static geometry is registered with the BodyStreamer instead of getting its
+     * Box2D body right away.
+     * @param object The GameObject to create the entity from
+     * @param registry The current enTT registry
+     * @param physicsWorld The current Box2D physics world
+     * @return The newly created entity
+     */
+    entt::entity LevelPlayState::createLevelEntity(GameObject& object, entt::registry& registry,
+                                                   const b2WorldId physicsWorld) const
+    {
+        if (!object.generatePhysicsComp || object.tag == "player")
         {
-            const auto& entity = engine::ecs::EntityFactory::createDefaultEntity(
-                object, registry, physicsWorld);
-            if (object.tag == "player") current_player = entity;
-            game.setPlayer(current_player);
+            return engine::ecs::EntityFactory::createDefaultEntity(object, registry, physicsWorld);
         }
+
+        GameObject visual = object;
+        visual.generatePhysicsComp = false;
+        const auto entity = engine::ecs::EntityFactory::createDefaultEntity(visual, registry, physicsWorld);
+        game.getPhysicsSystem()->getBodyStreamer().add(registry, entity, object);
+        return entity;
     }
 
-    void LevelPlayState::createEntities(const LevelBackgroundConfig& bgConfig, entt::registry& registry,
-                                        const b2WorldId physicsWorld)
+    /**
+     * Creates the grouped, then the single entities of the level, until this frame's instantiation budget is used up.
+     * At least one group or object is created per call, so loading always advances.
+     * @param registry The current enTT registry
+     * @param physicsWorld The current Box2D physics world
+     * @return True once every entity of the level exists
+     */
+    bool LevelPlayState::createEntitiesWithinBudget(entt::registry& registry, const b2WorldId physicsWorld)
     {
-        createSkyGradientEntity(bgConfig, registry, physicsWorld);
-        createBackgroundEntities(bgConfig, registry, physicsWorld);
-        createGroupedEntities(registry, physicsWorld);
-        createSingleEntities(registry, physicsWorld);
+        const auto deadline = std::chrono::steady_clock::now() + instantiation_budget;
+        auto& groups = current_level->groups;
+        auto& objects = current_level->objects;
+        while (next_group_index < groups.size() || next_object_index < objects.size())
+        {
+            if (next_group_index < groups.size())
+            {
+                createGroupedEntity(groups[next_group_index++], registry, physicsWorld);
+            }
+            else
+            {
+                createSingleEntity(objects[next_object_index++], registry, physicsWorld);
+            }
+            if (std::chrono::steady_clock::now() >= deadline) break;
+        }
+        return next_group_index >= groups.size() && next_object_index >= objects.size();
     }
 
     /**
-     * Initializes current level audio.
+     * Initializes current level audio from the finished analysis.
      */
     void LevelPlayState::initializeAudio()
     {
-        game.getAudioSystem()->initializeCurrentAudio(current_level->audioFileName, current_level->playerStartPosX);
+        game.getAudioSystem()->setCurrentAudio(audio_future.get(), current_level->playerStartPosX);
         audio_config = game.getAudioSystem()->getConfig();
         //Ensures, that every unit is synced to the beat
         current_level->currentLevelSpeed = current_level->velocityMultiplier / audio_config->seconds_per_beat;
@@ -210,26 +277,134 @@ namespace gl3::game::state
     }
 
     /**
-     * Loads the selected level via LevelManager, instantiates all entities from the loaded data structure (GameObject/Level),
-     * calls on AudioSystem to instantiate the current config = analyse audio, creates AABB for grouped objects,
-     * calculates levelLength, speed and final beat, and sends the current player to Game.
-     * Then sets up ui and internal properties for starting the level/edit mode.
+     * Sets how far ahead of the window the BodyStreamer creates bodies, once the level speed is known. Faster levels
+     * look further ahead, so a step doesn't have to create the bodies of a long stretch at once.
+     */
+    void LevelPlayState::configureBodyStreaming() const
+    {
+        const float lookAhead = std::max(min_stream_look_ahead,
+                                         current_level->currentLevelSpeed * stream_look_ahead_seconds);
+        game.getPhysicsSystem()->getBodyStreamer().setDistances(lookAhead, stream_look_behind);
+    }
+
+    /**
+     * Starts loading the selected level. The level file is read and parsed on a worker thread, unless LevelManager
+     * already has it. Everything else happens in @ref continueLoading over the next frames, while the loading UI shows
+     * the progress.
      */
     void LevelPlayState::loadLevel()
     {
+        // Start at the level begin, the camera may still be scrolled from a previous level
+        game.getContext().setCameraPosAndCenter({0.0f, 0.0f, 1.0f}, {0.f, 0.f, 0.f});
+        // Nothing simulates a half created level
+        setSystemsActive(false);
+        dynamic_cast<Game&>(game).setPaused(true);
+        loading_ui->setActive(true);
+
+        load_stage = engine::ecs::LevelLoadStage::ReadingLevel;
+        next_group_index = 0;
+        next_object_index = 0;
+        if (engine::levelLoading::LevelManager::isLevelLoaded(level_index))
+        {
+            current_level = engine::levelLoading::LevelManager::loadLevelByID(level_index);
+            startInstantiation();
+            return;
+        }
+        level_future = std::async(std::launch::async, [levelIndex = level_index]
+        {
+            return engine::levelLoading::LevelManager::readLevelByID(levelIndex);
+        });
+        sendLoadProgress(load_stage, 0.f);
+    }
+
+    /**
+     * Starts opening and analyzing the level's audio on a worker thread, then creates sky, backgrounds and ground,
+     * the remaining entities follow a few per frame.
+     */
+    void LevelPlayState::startInstantiation()
+    {
+        unsigned hopSize = 512;
+        unsigned bufferSize = 2048;
+        unsigned readAheadBytes = 256 * 1024;
+        if (const auto* config = game.getAudioSystem()->getConfig())
+        {
+            hopSize = config->hopSize;
+            bufferSize = config->bufferSize;
+            readAheadBytes = config->readAheadBytes;
+        }
+        audio_future = std::async(std::launch::async, &engine::audio::AudioSystem::loadAudio,
+                                  current_level->audioFileName, hopSize, bufferSize, readAheadBytes,
+                                  game.getAudioSystem()->getAnalysisJobSystem());
+
         auto& registry = game.getRegistry();
         const auto physicsWorld = game.getPhysicsWorld();
-        current_level = engine::levelLoading::LevelManager::loadLevelByID(level_index);
         const auto bgConfig = getBackgroundSizes(game.getContext().getWorldWindowBounds());
-        createEntities(bgConfig, registry, physicsWorld);
-        engine::ecs::EventDispatcher::dispatcher.trigger(engine::ecs::RenderComponentContainerChange{});
-        //signal that RenderComponents were added and need sorting
+        createSkyGradientEntity(bgConfig, registry, physicsWorld);
+        createBackgroundEntities(bgConfig, registry, physicsWorld);
+
+        load_stage = engine::ecs::LevelLoadStage::CreatingEntities;
+        sendLoadProgress(load_stage, 0.1f);
+    }
+
+    /**
+     * Advances loading: takes the level from the worker thread, creates entities within the frame budget (shaders,
+     * textures and Box2D bodies need the main thread) and waits for the audio analysis.
+     * Each finished stage falls through to the next one in the same frame.
+     */
+    void LevelPlayState::continueLoading()
+    {
+        using engine::ecs::LevelLoadStage;
+        if (load_stage == LevelLoadStage::ReadingLevel)
+        {
+            if (level_future.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+            {
+                sendLoadProgress(load_stage, 0.f);
+                return;
+            }
+            current_level = engine::levelLoading::LevelManager::addLoadedLevel(level_index, level_future.get());
+            startInstantiation();
+        }
 
-        initializeAudio();
+        if (load_stage == LevelLoadStage::CreatingEntities)
+        {
+            const bool created = createEntitiesWithinBudget(game.getRegistry(), game.getPhysicsWorld());
+            const size_t total = current_level->groups.size() + current_level->objects.size();
+            const float createdFraction = total > 0
+                                              ? static_cast<float>(next_group_index + next_object_index) /
+                                              static_cast<float>(total)
+                                              : 1.f;
+            if (!created)
+            {
+                sendLoadProgress(load_stage, 0.1f + 0.8f * createdFraction);
+                return;
+            }
+            load_stage = LevelLoadStage::AnalyzingAudio;
+        }
 
+        if (load_stage == LevelLoadStage::AnalyzingAudio)
+        {
+            if (audio_future.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+            {
+                sendLoadProgress(load_stage, 0.9f);
+                return;
+            }
+            initializeAudio();
+            configureBodyStreaming();
+            createGroundCollider(game.getRegistry(), game.getPhysicsWorld());
+            finishLoading();
+        }
+    }
+
+    /**
+     * Sets up ui and internal properties for starting the level/edit mode, once every part of the level is loaded.
+     */
+    void LevelPlayState::finishLoading()
+    {
         game.getContext().setClearColor(current_level->clearColor);
 
         level_instantiated = true;
+        load_stage = engine::ecs::LevelLoadStage::Done;
+        sendLoadProgress(load_stage, 1.f);
         instruction_ui->setEditMode(edit_mode);
 
         if (!edit_mode)
@@ -245,31 +420,27 @@ namespace gl3::game::state
     }
 
     /**
-     * Starts/stops movement of objects towards the player.
-     * @param move determines if the objects should start or stop moving towards the player.
+     * Triggers a LevelLoadProgress event.
+     * @param stage The current loading stage
+     * @param progress Overall progress from 0 to 1
      */
-    void LevelPlayState::moveObjects(const bool move) const
+    void LevelPlayState::sendLoadProgress(const engine::ecs::LevelLoadStage stage, const float progress) const
     {
-        for (const auto view = game.getRegistry().view<engine::ecs::TagComponent, engine::ecs::PhysicsComponent>();
-             auto& entity : view)
-        {
-            if (!game.getRegistry().valid(entity) || entity == entt::null)return;
-            const auto& physics_comp = view.get<engine::ecs::PhysicsComponent>(entity);
-            if (auto& tag = view.get<engine::ecs::TagComponent>(entity).tag; tag == "platform" || tag == "obstacle" ||
-                tag == "gravity" || tag == "visual")
-            {
-                if (move)
-                {
-                    b2Body_SetLinearVelocity(physics_comp.body, {current_level->currentLevelSpeed * -1, 0.0f});
-                }
-                else
-                {
-                    b2Body_SetLinearVelocity(physics_comp.body, {0.f, 0.0f});
-                }
-            }
-        }
+        engine::ecs::EventDispatcher::dispatcher.trigger(engine::ecs::LevelLoadProgress{stage, progress});
     }
 
+    /**
+     * Scrolls the camera by the distance the level moved this frame, the player runs along with it.
+     * Ground and backgrounds follow through the window bounds event, see @ref onWindowSizeChange.
+     * @param deltaTime The game's time since the previous frame.
+     */
+    void LevelPlayState::scrollFrame(const float deltaTime)
+    {
+        const float distance = current_level->currentLevelSpeed * deltaTime;
+        scroll_distance += distance;
+        game.getContext().scrollWindowX(distance);
+        dynamic_cast<Game&>(game).getPlayerInputSystem()->setScrollDistance(scroll_distance);
+    }
 
     /**
      * Pauses or resumes the level. @note This does not reset entities, audio, etc. it just stops/resumes audio, movement, and timers.
@@ -280,7 +451,6 @@ namespace gl3::game::state
         paused = pause;
         dynamic_cast<Game&>(game).setPaused(pause);
         setSystemsActive(!pause);
-        moveObjects(!pause);
         audio_config->audio.setPause(audio_config->currentAudioHandle, pause);
     }
 
@@ -300,6 +470,7 @@ namespace gl3::game::state
      */
     void LevelPlayState::onPauseEvent(const engine::ui::PauseLevelEvent& event)
     {
+        if (!level_instantiated) return;
         pauseOrResumeLevel(event.pauseLevel);
     }
 
@@ -309,7 +480,7 @@ namespace gl3::game::state
      */
     void LevelPlayState::onPlayerDeath(const engine::ecs::PlayerDeath& event)
     {
-        if (reloading_level) return;
+        if (reloading_level || !level_instantiated) return;
         game.getAudioSystem()->playOneShot("crash");
         onRestartLevel(engine::ui::RestartLevelEvent{true});
     }
@@ -320,7 +491,7 @@ namespace gl3::game::state
      */
     void LevelPlayState::onRestartLevel(const engine::ui::RestartLevelEvent& event)
     {
-        if (reloading_level) return;
+        if (reloading_level || !level_instantiated) return;
         // Reset camera to default position and center. (In case of editor scrolling)
         game.getContext().setCameraPosAndCenter(
             {0.0f, 0.0f, 1.0f},
@@ -346,22 +517,24 @@ namespace gl3::game::state
                 registry.get<engine::ecs::RenderComponent>(entity).uvOffset = {0.f, 0.f};
             }
 
-            auto& tag = registry.get<engine::ecs::TagComponent>(entity).tag;
-            if (tag == "background" || tag == "sky" || tag == "ground") return;
+            if (registry.all_of<engine::ecs::BackdropTag>(entity)) continue;
 
             //reset all transforms to initial state
+            const auto& initial = registry.get<engine::ecs::InitialTransformComponent>(entity);
             auto& transform = registry.get<engine::ecs::TransformComponent>(entity);
-            transform.position = transform.initialPosition;
-            transform.scale = transform.initialScale;
-            transform.zRotation = transform.initialZRotation;
+            transform.position = initial.position;
+            transform.previousPosition = initial.position;
+            transform.scale = initial.scale;
+            transform.zRotation = initial.zRotation;
+            registry.patch<engine::ecs::TransformComponent>(entity);
 
             //Some entities have a Physics Component
             if (registry.any_of<engine::ecs::PhysicsComponent>(entity))
             {
                 registry.get<engine::ecs::PhysicsComponent>(entity).isActive = true;
-                engine::ecs::EntityFactory::setPosition(registry, entity, transform.initialPosition);
-                engine::ecs::EntityFactory::setScale(registry, entity, transform.initialScale);
-                engine::ecs::EntityFactory::SetRotation(registry, entity, transform.initialZRotation);
+                engine::ecs::EntityFactory::setPosition(registry, entity, initial.position);
+                engine::ecs::EntityFactory::setScale(registry, entity, initial.scale);
+                engine::ecs::EntityFactory::SetRotation(registry, entity, initial.zRotation);
             }
 
             //Reset Physics Group Parents
@@ -411,6 +584,7 @@ namespace gl3::game::state
         game.getAudioSystem()->stopCurrentAudio();
 
         level_time = 0.f;
+        scroll_distance = 0.f;
         timer = 1.f;
         transition_triggered = false;
         timer_active = false;
@@ -461,19 +635,29 @@ namespace gl3::game::state
      */
     void LevelPlayState::unloadLevel()
     {
-        engine::levelLoading::LevelManager::saveCurrentLevel();
+        // Left while loading: wait for the worker threads, their results are dropped
+        level_future = {};
+        audio_future = {};
+        if (current_level) engine::levelLoading::LevelManager::saveCurrentLevel();
         level_time = 0.f;
+        if (level_instantiated) game.getAudioSystem()->stopCurrentAudio();
         level_instantiated = false;
-        game.getAudioSystem()->stopCurrentAudio();
         game.getAudioSystem()->stopAllOneShots();
         menu_ui->setActive(false);
         instruction_ui->setActive(false);
         finish_ui->setActive(false);
+        loading_ui->setActive(false);
         menu_ui = nullptr;
         instruction_ui = nullptr;
         finish_ui = nullptr;
+        loading_ui = nullptr;
 
+        game.getPhysicsSystem()->getBodyStreamer().clear();
         engine::ecs::EntityFactory::clearRegistry(game.getRegistry());
+        background_entities.clear();
+        next_group_index = 0;
+        next_object_index = 0;
+        scroll_distance = 0.f;
         level_index = -1;
         current_level = nullptr;
         current_player = entt::null;
@@ -486,11 +670,13 @@ namespace gl3::game::state
     {
         if (!level_instantiated)
         {
+            continueLoading();
             return;
         }
         if (!paused)
         {
             level_time += deltaTime;
+            scrollFrame(deltaTime);
             delayLevelEnd(deltaTime);
         }
     }
@@ -1,4 +1,6 @@
 #pragma once
+#include <chrono>
+#include <future>
 #include "engine/Game.h"
 #include "engine/audio/AudioSystem.h"
 #include "engine/ecs/EntityFactory.h"
@@ -10,6 +12,7 @@
 #include "ui/FinishUI.h"
 #include "ui/InGameMenuUI.h"
 #include "ui/InstructionUI.h"
+#include "ui/LoadingUI.h"
 
 namespace gl3::game::state
 {
@@ -52,6 +55,7 @@ namespace gl3::game::state
    menu_ui = topLvlUI->getSubsystem<ui::InGameMenuUI>();
    instruction_ui = topLvlUI->getSubsystem<ui::InstructionUI>();
    finish_ui = topLvlUI->getSubsystem<ui::FinishUI>();
+   loading_ui = topLvlUI->getSubsystem<ui::LoadingUI>();
 
    engine::ecs::EventDispatcher::dispatcher
     .sink<engine::ecs::PlayerDeath>()
@@ -94,7 +98,7 @@ namespace gl3::game::state
 
   /**
    * @brief Called when entering the LevelPlayState
-   * Activates UI, loads level assets.
+   * Activates UI, starts loading the level assets.
    */
   void onEnter() override
   {
@@ -123,14 +127,40 @@ namespace gl3::game::state
 
  private:
   /**
-   * @brief Load level data and instantiate entities.
+   * @brief Start loading the level, the file is read on a worker thread. @see continueLoading
    */
   void loadLevel();
 
   /**
-   * @brief Enable or disable entity movement.
+   * @brief Advance the loading pipeline by one frame.
    */
-  void moveObjects(bool move) const;
+  void continueLoading();
+
+  /**
+   * @brief Start the audio analysis and create the window filling entities, once the level is read.
+   */
+  void startInstantiation();
+
+  /**
+   * @brief Create level entities until the frame's time budget is used up.
+   * @return True once all entities are created.
+   */
+  bool createEntitiesWithinBudget(entt::registry& registry, b2WorldId physicsWorld);
+
+  /**
+   * @brief Start the level or editor, once everything is loaded.
+   */
+  void finishLoading();
+
+  /**
+   * @brief Let the loading UI know how far loading got.
+   */
+  void sendLoadProgress(engine::ecs::LevelLoadStage stage, float progress) const;
+
+  /**
+   * @brief Advance the camera and the player by the distance the level moved this frame.
+   */
+  void scrollFrame(float deltaTime);
 
   /**
    * @brief Pause or resume the level.
@@ -176,31 +206,41 @@ namespace gl3::game::state
    * @brief Create sky gradient entity.
    */
   void createSkyGradientEntity(const LevelBackgroundConfig& bgConfig,
-                               entt::registry& registry, b2WorldId physicsWorld) const;
+                               entt::registry& registry, b2WorldId physicsWorld);
 
   /**
    * @brief Create background entities.
    */
   void createBackgroundEntities(const LevelBackgroundConfig& bgConfig,
-                                entt::registry& registry, b2WorldId physicsWorld) const;
+                                entt::registry& registry, b2WorldId physicsWorld);
+
+  /**
+   * @brief Set the BodyStreamer's look ahead and look behind distances for the level's speed.
+   */
+  void configureBodyStreaming() const;
+
+  /**
+   * @brief Create the static ground body spanning the whole level.
+   */
+  void createGroundCollider(entt::registry& registry, b2WorldId physicsWorld) const;
 
   /**
-   * @brief Instantiate grouped entities.
+   * @brief Instantiate one group of entities and their physics parent.
    */
-  void createGroupedEntities(entt::registry& registry, b2WorldId physicsWorld) const;
+  void createGroupedEntity(GameObjectGroup& group, entt::registry& registry, b2WorldId physicsWorld) const;
 
   /**
-   * @brief Instantiate single, non-grouped entities.
+   * @brief Instantiate one level entity, streaming its body if possible.
    */
-  void createSingleEntities(entt::registry& registry, b2WorldId physicsWorld);
+  entt::entity createLevelEntity(GameObject& object, entt::registry& registry, b2WorldId physicsWorld) const;
 
   /**
-   * @brief High-level method for entity creation.
+   * @brief Instantiate a single, non-grouped entity.
    */
-  void createEntities(const LevelBackgroundConfig& bgConfig, entt::registry& registry, b2WorldId physicsWorld);
+  void createSingleEntity(GameObject& object, entt::registry& registry, b2WorldId physicsWorld);
 
   /**
-   * @brief Initialize audio configuration for the level.
+   * @brief Initialize audio configuration for the level from the finished audio analysis.
    */
   void initializeAudio();
 
@@ -229,6 +269,7 @@ namespace gl3::game::state
   ui::InGameMenuUI* menu_ui = nullptr;
   ui::FinishUI* finish_ui = nullptr;
   ui::InstructionUI* instruction_ui = nullptr;
+  ui::LoadingUI* loading_ui = nullptr;
   engine::audio::AudioConfig* audio_config = nullptr;
 
   bool edit_mode = false; ///< Is edit mode active
@@ -237,11 +278,26 @@ namespace gl3::game::state
   bool timer_active = false; ///< Has the timer to end the level been triggered
   bool transition_triggered = false; ///< Has level end transition already been triggered
   bool reloading_level = false; ///< Is the level already restarting
+  float scroll_distance = 0.f; ///< Distance the camera scrolled since the level start.
 
   float timer = 1.f;
   int level_index = -1;
 
   Level* current_level = nullptr; ///< Pointer to the current level, owned by LevelManager.
   entt::entity current_player = entt::null;
+  std::vector<entt::entity> background_entities; ///< Sky, background and ground visuals, kept fitted to the window.
+  bool has_ground_collider = false; ///< Does a ground of the level ask for physics.
+
+  // === Loading ===
+  /// Main thread time spent creating entities per frame while loading.
+  static constexpr std::chrono::milliseconds instantiation_budget{4};
+  float stream_look_ahead_seconds = 1.f; ///< Seconds of scrolling ahead of the window where level bodies exist.
+  float min_stream_look_ahead = 10.f; ///< Look ahead in world units for slow levels.
+  float stream_look_behind = 2.f; ///< Distance in world units behind the window where level bodies are freed.
+  engine::ecs::LevelLoadStage load_stage = engine::ecs::LevelLoadStage::ReadingLevel;
+  std::future<std::unique_ptr<Level>> level_future; ///< Level file read on a worker thread.
+  std::future<engine::audio::LoadedAudio> audio_future; ///< Level audio opened and analyzed on a worker thread.
+  size_t next_group_index = 0; ///< First group of the level not yet instantiated.
+  size_t next_object_index = 0; ///< First single object of the level not yet instantiated.
  };
 } // namespace gl3::game::state
@@ -0,0 +1,87 @@
+#include "LoadingUI.h"
+#include <algorithm>
+#include <string>
+#include "engine/userInterface/FontManager.h"
+#include "engine/userInterface/UIConstants.h"
+
+namespace gl3::game::ui
+{
+    namespace
+    {
+        /// @return The text shown for a loading stage.
+        const char* getStageText(const engine::ecs::LevelLoadStage stage)
+        {
+            switch (stage)
+            {
+            case engine::ecs::LevelLoadStage::ReadingLevel:
+                return "Reading level";
+            case engine::ecs::LevelLoadStage::CreatingEntities:
+                return "Building level";
+            case engine::ecs::LevelLoadStage::AnalyzingAudio:
+                return "Analyzing music";
+            default:
+                return "Ready";
+            }
+        }
+    }
+
+    void LoadingUI::drawLoadingScreen(const ImGuiViewport* viewport, ImFont* font) const
+    {
+        const auto viewportSize = viewport->Size;
+        const auto viewportPos = viewport->Pos;
+        const ImVec2 windowSize = {viewportSize.x * 0.4f, viewportSize.y * 0.2f};
+        ImGui::SetNextWindowPos({
+            viewportPos.x + (viewportSize.x - windowSize.x) * 0.5f, viewportPos.y + (viewportSize.y - windowSize.y) * 0.5f
+        });
+        ImGui::SetNextWindowSize(windowSize);
+        ImGui::PushFont(font);
+        ImGui::Begin("Loading", nullptr, flags);
+
+        // Dots keep moving even while a worker thread holds the progress still
+        const int dots = static_cast<int>(animation_time * 3.f) % 4;
+        const std::string text = std::string(getStageText(stage)) + std::string(dots, '.');
+        const ImVec2 textSize = ImGui::CalcTextSize(getStageText(stage));
+        ImGui::SetCursorPosX((windowSize.x - textSize.x) * 0.5f);
+        ImGui::Text("%s", text.c_str());
+
+        ImGui::PushStyleColor(ImGuiCol_FrameBg, UINeonColors::pastelNeonViolet);
+        ImGui::PushStyleColor(ImGuiCol_PlotHistogram, UINeonColors::Cyan);
+        ImGui::ProgressBar(shown_progress, {-1.f, 0.f}, "");
+        ImGui::PopStyleColor(2);
+
+        ImGui::PopFont();
+        ImGui::End();
+    }
+
+    void LoadingUI::update(const float deltaTime)
+    {
+        animation_time += deltaTime;
+        shown_progress = std::min(progress, shown_progress + std::max(progress - shown_progress, 0.05f) * deltaTime * 8.f);
+        drawLoadingScreen(ImGui::GetMainViewport(), engine::ui::FontManager::getFont("pixeloid-bold-26"));
+    }
+
+    void LoadingUI::setActive(const bool setActive)
+    {
+        is_active = setActive;
+        if (!setActive) return;
+        stage = engine::ecs::LevelLoadStage::ReadingLevel;
+        progress = 0.f;
+        shown_progress = 0.f;
+        animation_time = 0.f;
+    }
+
+    void LoadingUI::onLoadProgress(const engine::ecs::LevelLoadProgress& event)
+    {
+        stage = event.stage;
+        progress = event.progress;
+        if (stage == engine::ecs::LevelLoadStage::Done)
+        {
+            is_active = false;
+        }
+    }
+
+    void LoadingUI::reset()
+    {
+        is_active = false;
+    }
+} // gl3
@@ -0,0 +1,86 @@
+#pragma once
+#include "engine/Game.h"
+#include "engine/ecs/EventDispatcher.h"
+#include "engine/ecs/GameEvents.h"
+#include "engine/userInterface/IUISubSystem.h"
+#include "engine/userInterface/UIEvents.h"
+
+namespace gl3::game::ui
+{
+    /**
+     * @class LoadingUI
+     * @brief Loading screen shown while a level loads in the background.
+     *
+     * Follows the engine::ecs::LevelLoadProgress events and hides itself once the level is ready.
+     */
+    class LoadingUI final : public engine::ui::IUISubsystem
+    {
+    public:
+        /**
+         * @brief Constructs the LoadingUI subsystem.
+         * @param imguiIO Pointer to ImGui IO structure.
+         * @param game Reference to the main game instance.
+         */
+        explicit LoadingUI(ImGuiIO* imguiIO, engine::Game& game) : IUISubsystem(imguiIO, game)
+        {
+            engine::ecs::EventDispatcher::dispatcher.sink<engine::ecs::LevelLoadProgress>().connect<&
+                LoadingUI::onLoadProgress>(this);
+            engine::ecs::EventDispatcher::dispatcher.sink<engine::ui::LevelUnload>().connect<&
+                LoadingUI::reset>(this);
+        }
+
+        /**
+         * Unsubscribes events.
+         */
+        ~LoadingUI() override
+        {
+            engine::ecs::EventDispatcher::dispatcher.sink<engine::ecs::LevelLoadProgress>().disconnect<&
+                LoadingUI::onLoadProgress>(this);
+            engine::ecs::EventDispatcher::dispatcher.sink<engine::ui::LevelUnload>().disconnect<&
+                LoadingUI::reset>(this);
+        }
+
+        /**
+         * @brief Draws the loading screen. (update only gets called, if is_active)
+         */
+        void update(float deltaTime) override;
+
+        /**
+         * @brief Sets whether the loading screen is visible, showing it starts at no progress.
+         * @param setActive True to activate, false to deactivate.
+         */
+        void setActive(bool setActive) override;
+
+    private:
+        /**
+         * @brief Draws the loading text and progress bar in the center of the viewport.
+         * @param viewport Pointer to ImGui viewport.
+         * @param font Pointer to the font used for rendering text.
+         */
+        void drawLoadingScreen(const ImGuiViewport* viewport, ImFont* font) const;
+
+        /**
+         * @brief Stores the progress and hides the screen once the level is ready.
+         */
+        void onLoadProgress(const engine::ecs::LevelLoadProgress& event);
+
+        /**
+         * Resets all properties on level unload.
+         */
+        void reset();
+
+        engine::ecs::LevelLoadStage stage = engine::ecs::LevelLoadStage::ReadingLevel;
+        float progress = 0.f; ///< Last reported progress.
+        float shown_progress = 0.f; ///< Progress drawn, eased towards progress.
+        float animation_time = 0.f; ///< Drives the animated dots.
+
+        /// ImGui window flags for styling the loading window.
+        static constexpr ImGuiWindowFlags flags =
+            ImGuiWindowFlags_NoInputs |
+            ImGuiWindowFlags_NoMove |
+            ImGuiWindowFlags_NoCollapse |
+            ImGuiWindowFlags_NoTitleBar |
+            ImGuiWindowFlags_NoResize |
+            ImGuiWindowFlags_NoBackground;
+    };
+} // namespace gl3::game::ui
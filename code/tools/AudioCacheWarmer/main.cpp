@@ -0,0 +1,113 @@
+/**
+* @file main.cpp
+ * @brief AudioCacheWarmer: analyzes every track of an audio folder ahead of time and writes the analysis sidecars.
+ *
+ * Usage: AudioCacheWarmer <audioDir> <outputDir> [--force] [--hop <samples>] [--buffer <samples>]
+ *                        [--bands <count>] [--workers <count>]
+ * Writes <outputDir>/<track>.analysis for every track in <audioDir> with the default AnalysisSettings (or the given
+ * hop size, buffer size and number of energy bands). The runtime finds them next to the tracks in assets/audio, see
+ * engine/audio/AudioAnalysisCache.h. Each track is analyzed on --workers threads, all hardware threads by default.
+ */
+#include <iostream>
+#include <string>
+#include <unordered_set>
+#include "engine/JobSystem.h"
+#include "engine/audio/AudioAnalysisCache.h"
+
+using namespace gl3::engine;
+
+namespace
+{
+    /**
+     * @brief Analyze one track if its sidecar is missing or outdated.
+     * @param audioPath Path to the track.
+     * @param cachePath Destination path.
+     * @param settings Parameters of the analysis.
+     * @param jobSystem Runs the analysis.
+     * @param force Analyze even if the sidecar is up to date.
+     * @return True if the track was analyzed.
+     */
+    bool warm(const std::filesystem::path& audioPath, const std::filesystem::path& cachePath,
+              const AnalysisSettings& settings, JobSystem& jobSystem, const bool force)
+    {
+        if (!force && AudioAnalysisCache::load(audioPath, cachePath, settings)) return false;
+
+        const auto result = AudioAnalysis::analyze(audioPath.string(), settings, &jobSystem);
+        if (result.bpm <= 0.f)
+        {
+            throw std::runtime_error("no tempo detected");
+        }
+        AudioAnalysisCache::store(audioPath, cachePath, settings, result);
+        return true;
+    }
+}
+
+int main(const int argc, char* argv[])
+{
+    if (argc < 3)
+    {
+        std::cerr << "Usage: AudioCacheWarmer <audioDir> <outputDir> [--force] [--hop <samples>] [--buffer <samples>]"
+            " [--bands <count>] [--workers <count>]" << std::endl;
+        return 1;
+    }
+    const std::filesystem::path audioDir = argv[1];
+    const std::filesystem::path outputDir = argv[2];
+
+    bool force = false;
+    AnalysisSettings settings;
+    uint32_t workerCount = 0;
+    for (int i = 3; i < argc; ++i)
+    {
+        const std::string argument = argv[i];
+        if (argument == "--force") force = true;
+        else if (argument == "--hop" && i + 1 < argc) settings.hopSize = std::stoul(argv[++i]);
+        else if (argument == "--buffer" && i + 1 < argc) settings.bufferSize = std::stoul(argv[++i]);
+        else if (argument == "--bands" && i + 1 < argc) settings.energyBands = std::stoul(argv[++i]);
+        else if (argument == "--workers" && i + 1 < argc) workerCount = std::stoul(argv[++i]);
+        else
+        {
+            std::cerr << "Unknown argument " << argument << std::endl;
+            return 1;
+        }
+    }
+
+    static const std::unordered_set<std::string> validExtensions = {".wav", ".mp3", ".ogg", ".flac"};
+    size_t analyzed = 0;
+    size_t skipped = 0;
+    size_t failed = 0;
+
+    if (!std::filesystem::is_directory(audioDir))
+    {
+        std::cerr << audioDir << " is not a directory" << std::endl;
+        return 1;
+    }
+    // One pool for every track, instead of starting threads per analysis
+    JobSystem jobSystem(workerCount);
+    for (const auto& entry : std::filesystem::directory_iterator(audioDir))
+    {
+        if (!entry.is_regular_file() || !validExtensions.contains(entry.path().extension().string())) continue;
+
+        const auto cachePath = outputDir / entry.path().filename().concat(AudioAnalysisCache::extension);
+        try
+        {
+            if (warm(entry.path(), cachePath, settings, jobSystem, force))
+            {
+                std::cout << "Analyzed " << entry.path().filename().string() << std::endl;
+                ++analyzed;
+            }
+            else
+            {
+                ++skipped;
+            }
+        }
+        catch (const std::exception& e)
+        {
+            std::cerr << "Failed to analyze " << entry.path() << ": " << e.what() << std::endl;
+            ++failed;
+        }
+    }
+
+    std::cout << "AudioCacheWarmer: " << analyzed << " analyzed, " << skipped << " up to date, " << failed
+        << " failed" << std::endl;
+    return failed == 0 ? 0 : 1;
+}
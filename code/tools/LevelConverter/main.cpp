@@ -0,0 +1,142 @@
+/**
+* @file main.cpp
+ * @brief LevelConverter: converts level JSON files into binary .lvlb files and back.
+ *
+ * Usage: LevelConverter <levelDir|level.json|level.lvlb> <outputDir> [--force]
+ * Level JSON files (not the .meta.json files) become <outputDir>/<name>.lvlb, the runtime loads them instead of the
+ * JSON when they are up to date. A .lvlb input is written back as <outputDir>/<name>.json.
+ */
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "engine/FileFingerprint.h"
+#include "engine/levelLoading/LevelFile.h"
+
+using gl3::engine::FileFingerprint;
+using namespace gl3::engine::levelLoading;
+
+namespace
+{
+    /**
+     * @brief Read a whole file into memory.
+     * @param path Path to the file.
+     * @return The file content.
+     */
+    std::vector<std::byte> readFile(const std::filesystem::path& path)
+    {
+        std::ifstream stream(path, std::ios::binary | std::ios::ate);
+        std::vector<std::byte> bytes(static_cast<size_t>(stream.tellg()));
+        stream.seekg(0);
+        stream.read(reinterpret_cast<char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+        return bytes;
+    }
+
+    /**
+     * @param path A file path.
+     * @return True for level JSON files, metadata files are skipped.
+     */
+    bool isLevelJson(const std::filesystem::path& path)
+    {
+        return path.extension() == ".json" && path.filename().string().find(".meta") == std::string::npos;
+    }
+
+    /**
+     * @brief Convert a level JSON file if its binary version is missing or outdated.
+     * @param jsonPath Path to the JSON file.
+     * @param binaryPath Destination path.
+     * @param force Convert even if the binary version is up to date.
+     * @return True if the level was converted.
+     */
+    bool toBinary(const std::filesystem::path& jsonPath, const std::filesystem::path& binaryPath, const bool force)
+    {
+        const auto bytes = readFile(jsonPath);
+        const uint64_t sourceHash = FileFingerprint::hash(bytes);
+        const int64_t writeTime = FileFingerprint::getWriteTime(jsonPath);
+
+        if (LevelFileHeader header; !force && LevelFile::readHeader(binaryPath, header) &&
+            header.sourceSize == bytes.size() && header.sourceHash == sourceHash &&
+            header.sourceWriteTime == writeTime)
+        {
+            return false;
+        }
+
+        LevelFile::writeBinary(LevelFile::readJson(jsonPath), bytes.size(), sourceHash, writeTime, binaryPath);
+        return true;
+    }
+
+    /**
+     * @brief Write a binary level back as JSON.
+     * @param binaryPath Path to the .lvlb file.
+     * @param jsonPath Destination path.
+     */
+    void toJson(const std::filesystem::path& binaryPath, const std::filesystem::path& jsonPath)
+    {
+        const std::string json = LevelFile::toJson(LevelFile::readBinary(binaryPath));
+        if (jsonPath.has_parent_path()) std::filesystem::create_directories(jsonPath.parent_path());
+        std::ofstream file(jsonPath, std::ios::binary | std::ios::trunc);
+        if (!file || !(file << json))
+        {
+            throw std::runtime_error("Failed to write " + jsonPath.string());
+        }
+    }
+}
+
+int main(const int argc, char* argv[])
+{
+    if (argc < 3)
+    {
+        std::cerr << "Usage: LevelConverter <levelDir|level.json|level.lvlb> <outputDir> [--force]" << std::endl;
+        return 1;
+    }
+    const std::filesystem::path input = argv[1];
+    const std::filesystem::path outputDir = argv[2];
+    const bool force = argc > 3 && std::string(argv[3]) == "--force";
+
+    std::vector<std::filesystem::path> inputs;
+    if (std::filesystem::is_directory(input))
+    {
+        for (const auto& entry : std::filesystem::directory_iterator(input))
+        {
+            if (entry.is_regular_file() && isLevelJson(entry.path())) inputs.push_back(entry.path());
+        }
+    }
+    else
+    {
+        inputs.push_back(input);
+    }
+
+    size_t converted = 0;
+    size_t skipped = 0;
+    size_t failed = 0;
+    for (const auto& path : inputs)
+    {
+        try
+        {
+            if (path.extension() == LevelFile::binaryExtension)
+            {
+                toJson(path, outputDir / path.stem().concat(".json"));
+                std::cout << "Converted " << path.filename().string() << " to JSON" << std::endl;
+                ++converted;
+            }
+            else if (toBinary(path, outputDir / path.stem().concat(LevelFile::binaryExtension), force))
+            {
+                std::cout << "Converted " << path.filename().string() << std::endl;
+                ++converted;
+            }
+            else
+            {
+                ++skipped;
+            }
+        }
+        catch (const std::exception& e)
+        {
+            std::cerr << "Failed to convert " << path << ": " << e.what() << std::endl;
+            ++failed;
+        }
+    }
+
+    std::cout << "LevelConverter: " << converted << " converted, " << skipped << " up to date, " << failed
+        << " failed" << std::endl;
+    return failed == 0 ? 0 : 1;
+}
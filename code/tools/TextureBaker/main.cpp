@@ -0,0 +1,120 @@
+/**
+* @file main.cpp
+ * @brief TextureBaker: converts the texture folders into pre-decoded, mipmapped .ctex files.
+ *
+ * Usage: TextureBaker <assetDir> <outputDir> [--force]
+ * Bakes assets/textures, assets/backgroundTextures and assets/uiTextures into <outputDir>/<folder>/<name>.ctex.
+ * The runtime looks for them in assets/baked and falls back to the image files.
+ */
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <unordered_set>
+#include <vector>
+#include "engine/FileFingerprint.h"
+#include "engine/rendering/BakedTexture.h"
+
+using gl3::engine::FileFingerprint;
+using namespace gl3::engine::rendering;
+
+namespace
+{
+    /**
+     * @brief Read a whole file into memory.
+     * @param path Path to the file.
+     * @return The file content.
+     */
+    std::vector<std::byte> readFile(const std::filesystem::path& path)
+    {
+        std::ifstream stream(path, std::ios::binary | std::ios::ate);
+        std::vector<std::byte> bytes(static_cast<size_t>(stream.tellg()));
+        stream.seekg(0);
+        stream.read(reinterpret_cast<char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+        return bytes;
+    }
+
+    /**
+     * @brief Bake one image if its bake is missing or outdated.
+     * @param imagePath Path to the image.
+     * @param bakedPath Destination path.
+     * @param force Bake even if the bake is up to date.
+     * @return True if the image was baked.
+     */
+    bool bake(const std::filesystem::path& imagePath, const std::filesystem::path& bakedPath, const bool force)
+    {
+        const auto bytes = readFile(imagePath);
+        const uint64_t sourceHash = FileFingerprint::hash(bytes);
+        const int64_t writeTime = FileFingerprint::getWriteTime(imagePath);
+
+        if (BakedTextureHeader header; !force && BakedTexture::readHeader(bakedPath, header) &&
+            header.sourceSize == bytes.size() && header.sourceHash == sourceHash &&
+            header.sourceWriteTime == writeTime)
+        {
+            return false;
+        }
+
+        // Same defaults as TextureManager: tilesets without a grid in their name have 8x8 tiles
+        int tilesX = 8;
+        int tilesY = 8;
+        if (!Texture::parseTileGrid(imagePath.filename().string(), tilesX, tilesY))
+        {
+            tilesX = 0;
+            tilesY = 0;
+        }
+
+        const ImageData image = Texture::loadImage(imagePath.string());
+        BakedTexture::write(image, tilesX, tilesY, bytes.size(), sourceHash, writeTime, bakedPath);
+        return true;
+    }
+}
+
+int main(const int argc, char* argv[])
+{
+    if (argc < 3)
+    {
+        std::cerr << "Usage: TextureBaker <assetDir> <outputDir> [--force]" << std::endl;
+        return 1;
+    }
+    const std::filesystem::path assetDir = argv[1];
+    const std::filesystem::path outputDir = argv[2];
+    const bool force = argc > 3 && std::string(argv[3]) == "--force";
+
+    static const std::unordered_set<std::string> validExtensions = {".png", ".jpg", ".jpeg"};
+    size_t baked = 0;
+    size_t skipped = 0;
+    size_t failed = 0;
+
+    for (const auto* folder : {"textures", "backgroundTextures", "uiTextures"})
+    {
+        const auto folderPath = assetDir / folder;
+        if (!std::filesystem::is_directory(folderPath)) continue;
+
+        for (const auto& entry : std::filesystem::directory_iterator(folderPath))
+        {
+            if (!entry.is_regular_file() || !validExtensions.contains(entry.path().extension().string())) continue;
+
+            const auto bakedPath = outputDir / folder / entry.path().stem().concat(BakedTexture::extension);
+            try
+            {
+                if (bake(entry.path(), bakedPath, force))
+                {
+                    std::cout << "Baked " << entry.path().filename().string() << std::endl;
+                    ++baked;
+                }
+                else
+                {
+                    ++skipped;
+                }
+            }
+            catch (const std::exception& e)
+            {
+                std::cerr << "Failed to bake " << entry.path() << ": " << e.what() << std::endl;
+                ++failed;
+            }
+        }
+    }
+
+    std::cout << "TextureBaker: " << baked << " baked, " << skipped << " up to date, " << failed << " failed"
+        << std::endl;
+    return failed == 0 ? 0 : 1;
+}